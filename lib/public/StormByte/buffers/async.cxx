@@ -0,0 +1,143 @@
+#include <StormByte/buffers/async.hxx>
+
+#include <algorithm>
+
+using namespace StormByte::Buffers::Async;
+
+namespace {
+	thread_local Executor* current_executor = nullptr;
+}
+
+Task::promise_type::~promise_type() noexcept {
+	if (executor) {
+		executor->Finished();
+	}
+}
+
+Task::~Task() noexcept {
+	if (m_handle) {
+		m_handle.destroy();
+	}
+}
+
+Executor::Executor(const std::size_t& threads): m_tasks(0), m_stopping(false) {
+	const std::size_t count = std::max<std::size_t>(threads, 1);
+	m_threads.reserve(count);
+	for (std::size_t i = 0; i < count; i++) {
+		m_threads.emplace_back(&Executor::Run, this);
+	}
+}
+
+Executor::~Executor() noexcept {
+	Join();
+	{
+		std::lock_guard lock(m_mutex);
+		m_stopping = true;
+	}
+	m_jobs_cv.notify_all();
+	for (auto& thread: m_threads) {
+		thread.join();
+	}
+}
+
+Executor* Executor::Current() noexcept {
+	return current_executor;
+}
+
+void Executor::Join() {
+	std::unique_lock lock(m_mutex);
+	m_idle_cv.wait(lock, [this] { return m_tasks == 0; });
+}
+
+void Executor::Post(std::function<void()> job) {
+	{
+		std::lock_guard lock(m_mutex);
+		m_jobs.push_back(std::move(job));
+	}
+	m_jobs_cv.notify_one();
+}
+
+void Executor::Spawn(Task task) {
+	const auto handle = std::exchange(task.m_handle, nullptr);
+	handle.promise().executor = this;
+	{
+		std::lock_guard lock(m_mutex);
+		m_tasks++;
+	}
+	Post([handle] { handle.resume(); });
+}
+
+void Executor::Finished() noexcept {
+	std::lock_guard lock(m_mutex);
+	if (--m_tasks == 0) {
+		m_idle_cv.notify_all();
+	}
+}
+
+void Executor::Run() {
+	current_executor = this;
+	std::unique_lock lock(m_mutex);
+	while (true) {
+		m_jobs_cv.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+		if (m_jobs.empty()) {
+			return;
+		}
+		auto job = std::move(m_jobs.front());
+		m_jobs.pop_front();
+		lock.unlock();
+		job();
+		lock.lock();
+	}
+}
+
+Awaitable<StormByte::Buffers::ExpectedData<StormByte::Buffers::BufferOverflow>>::Operation StormByte::Buffers::Async::ReadOperation(std::shared_ptr<Shared> buffer, const std::size_t& length, std::function<ExpectedData<BufferOverflow>()> read) {
+	return [buffer = std::move(buffer), length, read = std::move(read)]() -> std::optional<ExpectedData<BufferOverflow>> {
+		while (true) {
+			// Taken before the read: a buffer closed afterwards may still have been written to
+			const bool writable = buffer->IsWritable();
+			auto data = read();
+			if (data || (!writable && !buffer->HasEnoughData(length))) {
+				return data;
+			}
+			if (writable && !buffer->HasEnoughData(length)) {
+				return std::nullopt;
+			}
+			// The bytes arrived after the read failed: its error is stale, read again
+		}
+	};
+}
+
+bool Waiter::Suspend(std::coroutine_handle<> handle) {
+	m_handle = handle;
+	m_executor = Executor::Current();
+	return Park();
+}
+
+bool Waiter::Park() {
+	while (true) {
+		// Take the generation before trying: a change after this point makes parking fail
+		const std::uint32_t generation = m_buffer->m_generation.load();
+		if (Attempt()) {
+			return false;
+		}
+		// Once parked another thread may resume and destroy the coroutine, so nothing is touched after
+		if (m_buffer->Park(generation, [this] { Wake(); })) {
+			return true;
+		}
+	}
+}
+
+void Waiter::Wake() {
+	const auto retry = [this] {
+		if (!Park()) {
+			m_handle.resume();
+		}
+	};
+	if (m_executor) {
+		// Keeps the waking thread from running the coroutine
+		m_executor->Post(retry);
+	}
+	else {
+		retry();
+	}
+}
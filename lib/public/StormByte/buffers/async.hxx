@@ -0,0 +1,315 @@
+#pragma once
+
+#include <StormByte/buffers/shared.hxx>
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace Async
+ * @brief Coroutine support for `Consumer` and `Producer`.
+ *
+ * A blocking read parks its thread until data arrives. Awaiting @see Consumer::ReadAsync,
+ * @see Consumer::ExtractAsync or @see Producer::WriteAsync instead suspends the coroutine only, so a few
+ * @see Executor threads can serve thousands of streams:
+ * ```cpp
+ * Async::Task Copy(Consumer input, Producer output) {
+ *     while (true) {
+ *         auto data = co_await input.ExtractAsync(4096);
+ *         if (!data) co_return;
+ *         co_await output.WriteAsync(std::move(*data));
+ *     }
+ * }
+ *
+ * Async::Executor executor(2);
+ * executor.Spawn(Copy(producer.Consumer(), output));
+ * executor.Join();
+ * ```
+ */
+namespace StormByte::Buffers::Async {
+	class Executor;
+
+	/**
+	 * @class Task
+	 * @brief A coroutine run to completion by an @see Executor.
+	 *
+	 * Tasks start suspended and only run once given to @see Executor::Spawn; a task destroyed before
+	 * that never runs. Their result is what they write to their buffers, so they return nothing, and
+	 * an exception escaping a task terminates the program as it would from a `std::thread`.
+	 */
+	class STORMBYTE_PUBLIC Task final {
+		friend class Executor;
+
+		public:
+			/**
+			 * @struct promise_type
+			 * @brief Coroutine promise of @see Task.
+			 */
+			struct STORMBYTE_PUBLIC promise_type {
+				Executor* executor = nullptr;										///< Executor running the task, told when it completes.
+
+				/**
+				 * @brief Destructor
+				 * Runs when the task completes and tells its executor.
+				 */
+				~promise_type() noexcept;
+
+				Task get_return_object() noexcept { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+				std::suspend_always initial_suspend() const noexcept { return {}; }
+				std::suspend_never final_suspend() const noexcept { return {}; }
+				void return_void() const noexcept {}
+				void unhandled_exception() const noexcept { std::terminate(); }
+			};
+
+			/**
+			 * @brief Deleted copy constructor
+			 */
+			Task(const Task& other)													= delete;
+
+			/**
+			 * @brief Move constructor
+			 * @param other Task to move, left empty.
+			 */
+			Task(Task&& other) noexcept: m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+			/**
+			 * @brief Destructor
+			 * Destroys the coroutine if it was never spawned.
+			 */
+			~Task() noexcept;
+
+			/**
+			 * @brief Deleted copy assignment operator
+			 */
+			Task& operator=(const Task& other)										= delete;
+
+			/**
+			 * @brief Deleted move assignment operator
+			 */
+			Task& operator=(Task&& other)											= delete;
+
+		private:
+			std::coroutine_handle<promise_type> m_handle;							///< Coroutine, null once spawned.
+
+			/**
+			 * @brief Constructor
+			 * @param handle Suspended coroutine.
+			 */
+			explicit Task(std::coroutine_handle<promise_type> handle) noexcept: m_handle(handle) {}
+	};
+
+	/**
+	 * @class Executor
+	 * @brief A fixed pool of threads resuming coroutines.
+	 *
+	 * Coroutines suspended in an awaitable created on one of its threads are resumed on the pool,
+	 * never on the thread whose write or read woke them. The executor must outlive its tasks:
+	 * its destructor waits for them with @see Join.
+	 */
+	class STORMBYTE_PUBLIC Executor final {
+		friend struct Task::promise_type;
+
+		public:
+			/**
+			 * @brief Constructor
+			 * @param threads Number of threads, at least one.
+			 */
+			explicit Executor(const std::size_t& threads = std::thread::hardware_concurrency());
+
+			/**
+			 * @brief Deleted copy constructor
+			 */
+			Executor(const Executor& other)											= delete;
+
+			/**
+			 * @brief Deleted move constructor
+			 */
+			Executor(Executor&& other)												= delete;
+
+			/**
+			 * @brief Destructor
+			 * Waits for every spawned task, then stops the threads.
+			 */
+			~Executor() noexcept;
+
+			/**
+			 * @brief Deleted copy assignment operator
+			 */
+			Executor& operator=(const Executor& other)								= delete;
+
+			/**
+			 * @brief Deleted move assignment operator
+			 */
+			Executor& operator=(Executor&& other)									= delete;
+
+			/**
+			 * @brief Retrieves the executor running the calling thread
+			 * @return The executor, or null if the thread does not belong to one.
+			 */
+			static Executor* 														Current() noexcept;
+
+			/**
+			 * @brief Waits until every spawned task completed
+			 *
+			 * Must not be called from a task, which would wait for itself.
+			 */
+			void 																	Join();
+
+			/**
+			 * @brief Queues a job to run on one of the threads
+			 * @param job Job to run.
+			 */
+			void 																	Post(std::function<void()> job);
+
+			/**
+			 * @brief Starts a task on one of the threads
+			 * @param task Task to run.
+			 */
+			void 																	Spawn(Task task);
+
+		private:
+			std::mutex m_mutex;														///< Guards the queue and the task count.
+			std::condition_variable m_jobs_cv;										///< Idle threads waiting for jobs.
+			std::condition_variable m_idle_cv;										///< Threads in @see Join.
+			std::deque<std::function<void()>> m_jobs;								///< Queued jobs.
+			std::size_t m_tasks;													///< Spawned tasks not completed yet.
+			bool m_stopping;														///< Set by the destructor to stop the threads.
+			std::vector<std::thread> m_threads;										///< Pool threads.
+
+			/**
+			 * @brief Counts a completed task
+			 */
+			void 																	Finished() noexcept;
+
+			/**
+			 * @brief Runs queued jobs until the executor stops
+			 */
+			void 																	Run();
+	};
+
+	/**
+	 * @class Waiter
+	 * @brief Suspension logic shared by every @see Awaitable.
+	 *
+	 * Retries the operation whenever the buffer changes, using @see Shared::Park instead of sleeping,
+	 * and resumes the coroutine once it completes. The retry runs on the executor the coroutine was
+	 * suspended from, or inline from the waking write or read when it was not running on one.
+	 */
+	class STORMBYTE_PUBLIC Waiter {
+		public:
+			/**
+			 * @brief Deleted copy constructor
+			 */
+			Waiter(const Waiter& other)												= delete;
+
+			/**
+			 * @brief Destructor
+			 */
+			virtual ~Waiter() noexcept												= default;
+
+			/**
+			 * @brief Deleted copy assignment operator
+			 */
+			Waiter& operator=(const Waiter& other)									= delete;
+
+		protected:
+			/**
+			 * @brief Constructor
+			 * @param buffer Buffer the operation works on.
+			 */
+			explicit Waiter(std::shared_ptr<Shared> buffer) noexcept: m_buffer(std::move(buffer)), m_executor(nullptr) {}
+
+			/**
+			 * @brief Tries the operation once without blocking
+			 * @return True if it completed, successfully or not.
+			 */
+			virtual bool 															Attempt() = 0;
+
+			/**
+			 * @brief Suspends a coroutine until the operation completes
+			 * @param handle Coroutine awaiting the operation.
+			 * @return False if it completed meanwhile and the coroutine must not suspend.
+			 */
+			bool 																	Suspend(std::coroutine_handle<> handle);
+
+		private:
+			std::shared_ptr<Shared> m_buffer;										///< Buffer the operation works on.
+			std::coroutine_handle<> m_handle;										///< Suspended coroutine.
+			Executor* m_executor;													///< Executor resuming the coroutine, null to resume inline.
+
+			/**
+			 * @brief Retries the operation until it completes or is parked on the buffer
+			 * @return True if parked, false if completed.
+			 */
+			bool 																	Park();
+
+			/**
+			 * @brief Called by the buffer after a change, retries the operation
+			 */
+			void 																	Wake();
+	};
+
+	/**
+	 * @class Awaitable
+	 * @brief A buffer operation a coroutine can `co_await` without blocking its thread.
+	 *
+	 * The operation is tried at once and again after every change to the buffer, the coroutine
+	 * only suspends while it has to. Returned by @see Consumer::ReadAsync, @see Consumer::ExtractAsync
+	 * and @see Producer::WriteAsync; it must be awaited before the statement creating it ends.
+	 *
+	 * @tparam Result Result of the operation.
+	 */
+	template<typename Result>
+	class Awaitable final: public Waiter {
+		public:
+			/**
+			 * @brief Operation tried without blocking: returns its result, or none to wait for a change.
+			 */
+			using Operation = std::function<std::optional<Result>()>;
+
+			/**
+			 * @brief Constructor
+			 * @param buffer Buffer the operation works on.
+			 * @param operation Operation to complete.
+			 */
+			Awaitable(std::shared_ptr<Shared> buffer, Operation operation):
+			Waiter(std::move(buffer)), m_operation(std::move(operation)) {}
+
+			bool await_ready() { return Attempt(); }
+			bool await_suspend(std::coroutine_handle<> handle) { return Suspend(handle); }
+			Result await_resume() { return std::move(*m_result); }
+
+		private:
+			Operation m_operation;													///< Operation to complete.
+			std::optional<Result> m_result;											///< Result, once completed.
+
+			bool Attempt() override {
+				m_result = m_operation();
+				return m_result.has_value();
+			}
+	};
+
+	/**
+	 * @brief Builds the operation behind @see Consumer::ReadAsync and @see Consumer::ExtractAsync
+	 *
+	 * A failed `read` waits for a change while the buffer is writable, and is tried again at once if the
+	 * bytes arrived right after it failed. Its error is only the result once the buffer was closed before
+	 * the read and does not hold `length` bytes.
+	 *
+	 * @param buffer Buffer read from.
+	 * @param length Bytes to read.
+	 * @param read Read that never waits, such as @see Shared::TryRead.
+	 * @return The operation of an @see Awaitable.
+	 */
+	STORMBYTE_PUBLIC Awaitable<ExpectedData<BufferOverflow>>::Operation 	ReadOperation(std::shared_ptr<Shared> buffer, const std::size_t& length, std::function<ExpectedData<BufferOverflow>()> read);
+}
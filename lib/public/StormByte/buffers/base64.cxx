@@ -0,0 +1,333 @@
+#include <StormByte/buffers/base64.hxx>
+#include <StormByte/buffers/consumer.hxx>
+#include <StormByte/buffers/cpu.hxx>
+#include <StormByte/buffers/producer.hxx>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+using namespace StormByte::Buffers;
+
+namespace {
+	constexpr std::uint8_t Invalid = 0xFF;
+
+	struct Codec {
+		const char* characters;											// The 64 characters in value order
+		std::array<std::uint8_t, 256> values;							// Value of every character, `Invalid` for the rest
+		// SSSE3 classification: a character is valid when `lo[low nibble] & hi[high nibble]` is 0
+		std::array<std::int8_t, 16> lo, hi;
+		// SSSE3 translation: offsets added to a character by high nibble, `special` gets `adjust` more
+		std::array<std::int8_t, 16> roll;
+		char special;
+		std::int8_t adjust;
+	};
+
+	constexpr std::array<std::uint8_t, 256> ValueTable(const char* characters) {
+		std::array<std::uint8_t, 256> values {};
+		values.fill(Invalid);
+		for (std::uint8_t value = 0; value < 64; value++) {
+			values[static_cast<std::uint8_t>(characters[value])] = value;
+		}
+		return values;
+	}
+
+	constexpr char StandardCharacters[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	constexpr char URLCharacters[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+	// High nibble classes: 2, 3, 4 and 6, 5, 7 each get a bit, 0, 1 and 8-F are always invalid
+	constexpr Codec Standard {
+		StandardCharacters, ValueTable(StandardCharacters),
+		{ 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A },
+		{ 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
+		{ 0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0 },
+		'/', -3
+	};
+
+	// As above but 7 gets its own bit, since `_` is valid with high nibble 5 and DEL is not with 7
+	constexpr Codec URL {
+		URLCharacters, ValueTable(URLCharacters),
+		{ 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33 },
+		{ 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
+		{ 0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0 },
+		'_', 33
+	};
+
+	const Codec& CodecOf(const Base64::Alphabet& alphabet) noexcept {
+		return alphabet == Base64::Alphabet::URL ? URL : Standard;
+	}
+
+	std::size_t EncodeScalar(const std::uint8_t* data, const std::size_t& length, const char* characters, const bool& padding, char* output) noexcept {
+		char* start = output;
+		std::size_t index = 0;
+		for (; index + 3 <= length; index += 3) {
+			const std::uint32_t group = (std::uint32_t{data[index]} << 16) | (std::uint32_t{data[index + 1]} << 8) | data[index + 2];
+			*output++ = characters[group >> 18];
+			*output++ = characters[(group >> 12) & 0x3F];
+			*output++ = characters[(group >> 6) & 0x3F];
+			*output++ = characters[group & 0x3F];
+		}
+		if (index < length) {
+			const bool two = length - index == 2;
+			const std::uint32_t group = (std::uint32_t{data[index]} << 16) | (two ? std::uint32_t{data[index + 1]} << 8 : 0);
+			*output++ = characters[group >> 18];
+			*output++ = characters[(group >> 12) & 0x3F];
+			if (two) {
+				*output++ = characters[(group >> 6) & 0x3F];
+			}
+			if (padding) {
+				*output++ = '=';
+				if (!two) {
+					*output++ = '=';
+				}
+			}
+		}
+		return static_cast<std::size_t>(output - start);
+	}
+
+	// Decodes whole 4 character groups, returns how many characters were decoded before the first invalid group
+	std::size_t DecodeScalar(const std::uint8_t* text, const std::size_t& length, const Codec& codec, std::uint8_t* output) noexcept {
+		std::size_t index = 0;
+		for (; index + 4 <= length; index += 4) {
+			const std::uint8_t a = codec.values[text[index]], b = codec.values[text[index + 1]];
+			const std::uint8_t c = codec.values[text[index + 2]], d = codec.values[text[index + 3]];
+			if (((a | b | c | d) & 0xC0) != 0) {
+				break;
+			}
+			const std::uint32_t group = (std::uint32_t{a} << 18) | (std::uint32_t{b} << 12) | (std::uint32_t{c} << 6) | d;
+			*output++ = static_cast<std::uint8_t>(group >> 16);
+			*output++ = static_cast<std::uint8_t>(group >> 8);
+			*output++ = static_cast<std::uint8_t>(group);
+		}
+		return index;
+	}
+
+	#ifdef STORMBYTE_BUFFERS_X86
+	SSSE3_TARGET inline __m128i Load(const std::array<std::int8_t, 16>& values) noexcept {
+		return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data()));
+	}
+
+	// Offsets from a 6-bit value to its character, indexed by `value - 51` saturated (13 for values below 26)
+	SSSE3_TARGET __m128i ShiftTable(const Codec& codec) noexcept {
+		return _mm_setr_epi8(
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+			static_cast<char>(codec.characters[62] - 62), static_cast<char>(codec.characters[63] - 63), 'A', 0, 0
+		);
+	}
+
+	// Consumes 12 of every 16 loaded bytes, returns the number of bytes encoded
+	SSSE3_TARGET std::size_t EncodeSSSE3(const std::uint8_t* data, const std::size_t& length, const Codec& codec, char* output) noexcept {
+		const __m128i shift = ShiftTable(codec);
+		std::size_t index = 0;
+		for (; index + 16 <= length; index += 12, output += 16) {
+			// Spread every 3 bytes over a 32-bit lane and isolate its four 6-bit values
+			__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+			bytes = _mm_shuffle_epi8(bytes, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+			const __m128i high = _mm_mulhi_epu16(_mm_and_si128(bytes, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+			const __m128i low = _mm_mullo_epi16(_mm_and_si128(bytes, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+			const __m128i values = _mm_or_si128(high, low);
+
+			__m128i index_of = _mm_subs_epu8(values, _mm_set1_epi8(51));
+			index_of = _mm_or_si128(index_of, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), values), _mm_set1_epi8(13)));
+			const __m128i characters = _mm_add_epi8(values, _mm_shuffle_epi8(shift, index_of));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output), characters);
+		}
+		return index;
+	}
+
+	// Decodes 16 characters into 12 bytes per step, stopping before the first block with an invalid character.
+	// Every step stores 16 bytes, so `length` must leave at least 4 bytes of output after the last block.
+	SSSE3_TARGET std::size_t DecodeSSSE3(const std::uint8_t* text, const std::size_t& length, const Codec& codec, std::uint8_t* output) noexcept {
+		const __m128i lo_table = Load(codec.lo), hi_table = Load(codec.hi), roll_table = Load(codec.roll);
+		const __m128i nibble = _mm_set1_epi8(0x0F);
+		std::size_t index = 0;
+		for (; index + 16 <= length; index += 16, output += 12) {
+			const __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + index));
+			const __m128i high = _mm_and_si128(_mm_srli_epi32(characters, 4), nibble);
+			const __m128i low = _mm_and_si128(characters, nibble);
+			const __m128i invalid = _mm_and_si128(_mm_shuffle_epi8(lo_table, low), _mm_shuffle_epi8(hi_table, high));
+			if (_mm_movemask_epi8(_mm_cmpgt_epi8(invalid, _mm_setzero_si128())) != 0) {
+				break;
+			}
+
+			__m128i roll = _mm_shuffle_epi8(roll_table, high);
+			roll = _mm_add_epi8(roll, _mm_and_si128(_mm_cmpeq_epi8(characters, _mm_set1_epi8(codec.special)), _mm_set1_epi8(codec.adjust)));
+			const __m128i values = _mm_add_epi8(characters, roll);
+
+			// Merge pairs of 6-bit values, then pairs of 12-bit values, and pack the 24-bit groups big endian
+			const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+			const __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+			const __m128i bytes = _mm_shuffle_epi8(groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output), bytes);
+		}
+		return index;
+	}
+	#endif
+
+	std::size_t EncodeInto(const ConstByteSpan& data, const Codec& codec, const bool& padding, char* output) noexcept {
+		const auto* bytes = reinterpret_cast<const std::uint8_t*>(data.data());
+		std::size_t encoded = 0;
+		#ifdef STORMBYTE_BUFFERS_X86
+		if (CPU::HasSSSE3()) {
+			encoded = EncodeSSSE3(bytes, data.size(), codec, output);
+		}
+		#endif
+		return 4 * encoded / 3 + EncodeScalar(bytes + encoded, data.size() - encoded, codec.characters, padding, output + 4 * encoded / 3);
+	}
+
+	Data EncodeData(const ConstByteSpan& data, const Codec& codec, const bool& padding) {
+		Data text(Base64::EncodedSize(data.size(), padding));
+		EncodeInto(data, codec, padding, reinterpret_cast<char*>(text.data()));
+		return text;
+	}
+
+	ExpectedData<BufferCorrupted> InvalidCharacter(const std::uint8_t* text, const std::size_t& from, const std::size_t& length, const Codec& codec) {
+		std::size_t offset = from;
+		while (offset < length && codec.values[text[offset]] != Invalid) {
+			offset++;
+		}
+		return StormByte::Unexpected<BufferCorrupted>("Invalid Base64 character at offset {}", offset);
+	}
+
+	// Decodes text; unless `last` is set it must be whole unpadded groups, as sent by the streaming decoder
+	ExpectedData<BufferCorrupted> DecodeText(const ConstByteSpan& text, const Codec& codec, const bool& last) {
+		const auto* characters = reinterpret_cast<const std::uint8_t*>(text.data());
+		std::size_t length = text.size();
+		if (last && length % 4 == 0 && length > 0 && characters[length - 1] == '=') {
+			length -= characters[length - 2] == '=' ? 2 : 1;
+		}
+		const std::size_t tail = length % 4;
+		if (tail == 1 || (!last && tail != 0)) {
+			return StormByte::Unexpected<BufferCorrupted>("Base64 text of {} characters is truncated", length);
+		}
+
+		const std::size_t whole = length - tail;
+		Data decoded(whole / 4 * 3 + (tail > 0 ? tail - 1 : 0));
+		auto* output = reinterpret_cast<std::uint8_t*>(decoded.data());
+		std::size_t index = 0;
+		#ifdef STORMBYTE_BUFFERS_X86
+		// Keep two groups out of the vector loop so its 16 byte stores stay inside `decoded`
+		if (CPU::HasSSSE3() && whole >= 8) {
+			index = DecodeSSSE3(characters, whole - 8, codec, output);
+		}
+		#endif
+		index += DecodeScalar(characters + index, whole - index, codec, output + index / 4 * 3);
+		if (index < whole) {
+			return InvalidCharacter(characters, index, whole, codec);
+		}
+
+		if (tail > 0) {
+			std::uint32_t group = 0;
+			for (std::size_t i = 0; i < tail; i++) {
+				const std::uint8_t value = codec.values[characters[whole + i]];
+				if (value == Invalid) {
+					return InvalidCharacter(characters, whole, length, codec);
+				}
+				group |= std::uint32_t{value} << (18 - 6 * i);
+			}
+			// Bits past the last byte must be zero for the encoding to be canonical
+			if ((group & (tail == 2 ? 0xFFFF : 0xFF)) != 0) {
+				return StormByte::Unexpected<BufferCorrupted>("Base64 text has trailing bits set at offset {}", length - 1);
+			}
+			output += whole / 4 * 3;
+			output[0] = static_cast<std::uint8_t>(group >> 16);
+			if (tail == 3) {
+				output[1] = static_cast<std::uint8_t>(group >> 8);
+			}
+		}
+		return decoded;
+	}
+}
+
+std::size_t Base64::EncodedSize(const std::size_t& length, const bool& padding) noexcept {
+	return padding ? (length + 2) / 3 * 4 : length / 3 * 4 + (length % 3 == 0 ? 0 : length % 3 + 1);
+}
+
+std::size_t Base64::Encode(const ConstByteSpan& data, char* output, const Alphabet& alphabet, const bool& padding) noexcept {
+	return EncodeInto(data, CodecOf(alphabet), padding, output);
+}
+
+std::string Base64::Encode(const ConstByteSpan& data, const Alphabet& alphabet, const bool& padding) {
+	std::string text(EncodedSize(data.size(), padding), '\0');
+	EncodeInto(data, CodecOf(alphabet), padding, text.data());
+	return text;
+}
+
+Write::Status Base64::Encode(const ConstByteSpan& data, Simple& output, const Alphabet& alphabet, const bool& padding) {
+	return output.Write(EncodeData(data, CodecOf(alphabet), padding));
+}
+
+ExpectedData<BufferCorrupted> Base64::Decode(const ConstByteSpan& text, const Alphabet& alphabet) {
+	return DecodeText(text, CodecOf(alphabet), true);
+}
+
+ExpectedData<BufferCorrupted> Base64::Decode(const std::string& text, const Alphabet& alphabet) {
+	return DecodeText(ConstByteSpan(reinterpret_cast<const Byte*>(text.data()), text.size()), CodecOf(alphabet), true);
+}
+
+StormByte::Expected<Simple, BufferCorrupted> Base64::Decode(const Simple& buffer, const Alphabet& alphabet) {
+	auto decoded = DecodeText(buffer.Span().subspan(buffer.Position()), CodecOf(alphabet), true);
+	if (!decoded) {
+		return StormByte::Unexpected(decoded.error());
+	}
+	return Simple(std::move(decoded.value()));
+}
+
+PipeFunction Base64::Encoder(const Alphabet& alphabet, const bool& padding) {
+	return [&codec = CodecOf(alphabet), padding](Consumer input, Producer output) {
+		while (input.PeekView(3)) {
+			auto chunk = input.Extract(input.AvailableBytes() / 3 * 3);
+			if (!chunk) {
+				break;
+			}
+			output.Write(EncodeData(*chunk, codec, padding));
+		}
+		if (input.Status() == Status::Error) {
+			output << Status::Error;
+			return;
+		}
+		// Closed input: what is left is the last, partial group
+		if (input.AvailableBytes() > 0) {
+			auto chunk = input.Extract(input.AvailableBytes());
+			if (!chunk) {
+				output << Status::Error;
+				return;
+			}
+			output.Write(EncodeData(*chunk, codec, padding));
+		}
+		output << Status::ReadOnly;
+	};
+}
+
+PipeFunction Base64::Decoder(const Alphabet& alphabet) {
+	return [&codec = CodecOf(alphabet)](Consumer input, Producer output) {
+		// Decode whole groups while at least one more character is stored, keeping the possibly padded last group
+		while (input.PeekView(5)) {
+			auto chunk = input.Extract((input.AvailableBytes() - 1) / 4 * 4);
+			if (!chunk) {
+				break;
+			}
+			auto decoded = DecodeText(*chunk, codec, false);
+			if (!decoded) {
+				output << Status::Error;
+				return;
+			}
+			output.Write(std::move(*decoded));
+		}
+		if (input.Status() == Status::Error) {
+			output << Status::Error;
+			return;
+		}
+		// Closed input: what is left is the last group
+		if (input.AvailableBytes() > 0) {
+			auto chunk = input.Extract(input.AvailableBytes());
+			auto decoded = chunk ? DecodeText(*chunk, codec, true) : StormByte::Unexpected<BufferCorrupted>("Truncated Base64 text");
+			if (!decoded) {
+				output << Status::Error;
+				return;
+			}
+			output.Write(std::move(*decoded));
+		}
+		output << Status::ReadOnly;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <StormByte/buffers/exception.hxx>
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+#include <string>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers::Base64 {
+	/**
+	 * @enum Alphabet
+	 * @brief Base64 alphabets from RFC 4648.
+	 */
+	enum class Alphabet: unsigned short {
+		Standard,																	///< `A-Z`, `a-z`, `0-9`, `+` and `/`.
+		URL																			///< `A-Z`, `a-z`, `0-9`, `-` and `_`, safe in URLs and file names.
+	};
+
+	/**
+	 * @brief Computes the exact encoded length.
+	 * @param length Number of bytes to encode.
+	 * @param padding Whether the last group is padded with `=` to 4 characters.
+	 * @return Number of characters of the encoding.
+	 */
+	STORMBYTE_PUBLIC std::size_t 											EncodedSize(const std::size_t& length, const bool& padding = true) noexcept;
+
+	/**
+	 * @brief Encodes bytes into a caller provided buffer.
+	 *
+	 * Uses SSSE3 when the processor supports it and a table driven encoder otherwise.
+	 *
+	 * @param data Bytes to encode.
+	 * @param output Destination, must hold at least `EncodedSize(data.size(), padding)` characters.
+	 * @param alphabet Alphabet to encode with.
+	 * @param padding Whether the last group is padded with `=` to 4 characters.
+	 * @return Number of characters written.
+	 */
+	STORMBYTE_PUBLIC std::size_t 											Encode(const ConstByteSpan& data, char* output, const Alphabet& alphabet = Alphabet::Standard, const bool& padding = true) noexcept;
+
+	/**
+	 * @brief Encodes bytes into a string allocated once with its final size.
+	 * @param data Bytes to encode.
+	 * @param alphabet Alphabet to encode with.
+	 * @param padding Whether the last group is padded with `=` to 4 characters.
+	 * @return The encoded text.
+	 */
+	STORMBYTE_PUBLIC std::string 											Encode(const ConstByteSpan& data, const Alphabet& alphabet = Alphabet::Standard, const bool& padding = true);
+
+	/**
+	 * @brief Encodes bytes and appends the text to a buffer.
+	 * @param data Bytes to encode.
+	 * @param output Buffer receiving the encoded text.
+	 * @param alphabet Alphabet to encode with.
+	 * @param padding Whether the last group is padded with `=` to 4 characters.
+	 * @return The status of the write.
+	 */
+	STORMBYTE_PUBLIC Write::Status 											Encode(const ConstByteSpan& data, Simple& output, const Alphabet& alphabet = Alphabet::Standard, const bool& padding = true);
+
+	/**
+	 * @brief Decodes Base64 text.
+	 *
+	 * Padding is optional, but when present the text length must be a multiple of 4. Whitespace, characters
+	 * outside the alphabet and non zero bits after the last byte are rejected.
+	 *
+	 * @param text Encoded text.
+	 * @param alphabet Alphabet the text was encoded with.
+	 * @return The decoded bytes, or a `BufferCorrupted` error naming the offending offset.
+	 */
+	STORMBYTE_PUBLIC ExpectedData<BufferCorrupted> 							Decode(const ConstByteSpan& text, const Alphabet& alphabet = Alphabet::Standard);
+
+	/**
+	 * @brief Decodes Base64 text.
+	 * @param text Encoded text.
+	 * @param alphabet Alphabet the text was encoded with.
+	 * @return The decoded bytes, or a `BufferCorrupted` error naming the offending offset.
+	 * @see Decode(const ConstByteSpan&, const Alphabet&)
+	 */
+	STORMBYTE_PUBLIC ExpectedData<BufferCorrupted> 							Decode(const std::string& text, const Alphabet& alphabet = Alphabet::Standard);
+
+	/**
+	 * @brief Decodes the unread text of a buffer.
+	 * @param buffer Buffer holding the encoded text; `Shared` buffers must not be written meanwhile.
+	 * @param alphabet Alphabet the text was encoded with.
+	 * @return Buffer with the decoded bytes, or a `BufferCorrupted` error naming the offending offset.
+	 */
+	STORMBYTE_PUBLIC Expected<Simple, BufferCorrupted> 						Decode(const Simple& buffer, const Alphabet& alphabet = Alphabet::Standard);
+
+	/**
+	 * @brief Creates a pipe encoding its input to Base64.
+	 *
+	 * Whole 3 byte groups are encoded as soon as they arrive and the last partial group once the input
+	 * closes. The output is closed with `Status::ReadOnly`, or set to `Status::Error` if the input ends in error.
+	 *
+	 * @param alphabet Alphabet to encode with.
+	 * @param padding Whether the last group is padded with `=` to 4 characters.
+	 * @return The pipe function.
+	 */
+	STORMBYTE_PUBLIC PipeFunction 											Encoder(const Alphabet& alphabet = Alphabet::Standard, const bool& padding = true);
+
+	/**
+	 * @brief Creates a pipe decoding Base64 text.
+	 *
+	 * Whole 4 character groups are decoded as soon as they arrive; the last group is held back until the input
+	 * closes since it may be padded. The output is set to `Status::Error` on invalid text, and closed with
+	 * `Status::ReadOnly` otherwise.
+	 *
+	 * @param alphabet Alphabet the text was encoded with.
+	 * @return The pipe function.
+	 */
+	STORMBYTE_PUBLIC PipeFunction 											Decoder(const Alphabet& alphabet = Alphabet::Standard);
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include <StormByte/buffers/binary.hxx>
+
+#include <algorithm>
+
+using namespace StormByte::Buffers;
+
+std::size_t Binary::EncodeVarint(std::uint64_t value, const bool& is_signed, Byte* data) noexcept {
+	std::size_t length = 0;
+	while (true) {
+		const auto byte = static_cast<std::uint8_t>(value & 0x7F);
+		bool done;
+		if (is_signed) {
+			// Arithmetic shift keeps the sign, stop once the rest is pure sign extension
+			value = static_cast<std::uint64_t>(static_cast<std::int64_t>(value) >> 7);
+			done = (value == 0 && (byte & 0x40) == 0) || (value == ~std::uint64_t(0) && (byte & 0x40) != 0);
+		} else {
+			value >>= 7;
+			done = value == 0;
+		}
+		data[length++] = static_cast<Byte>(done ? byte : byte | 0x80);
+		if (done) {
+			return length;
+		}
+	}
+}
+
+std::size_t Binary::DecodeVarint(const ConstByteSpan& data, const bool& is_signed, std::uint64_t& value) noexcept {
+	const std::size_t limit = std::min(data.size(), MaxVarintSize);
+	std::uint64_t result = 0;
+	unsigned int shift = 0;
+
+	for (std::size_t index = 0; index < limit; index++) {
+		const auto byte = static_cast<std::uint8_t>(data[index]);
+		// The last byte only holds bit 63, any other payload bit must be its sign extension
+		if (shift == 63) {
+			const std::uint8_t payload = byte & 0x7F;
+			if (is_signed ? payload != 0 && payload != 0x7F : payload > 1) {
+				return 0;
+			}
+		}
+		result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+		shift += 7;
+		if ((byte & 0x80) == 0) {
+			if (is_signed && shift < 64 && (byte & 0x40) != 0) {
+				result |= ~std::uint64_t(0) << shift;
+			}
+			value = result;
+			return index + 1;
+		}
+	}
+	return 0;
+}
\ No newline at end of file
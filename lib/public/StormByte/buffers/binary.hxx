@@ -0,0 +1,97 @@
+#pragma once
+
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers::Binary {
+	/**
+	 * @brief Types with a fixed size binary encoding: arithmetic and enumeration types of 1, 2, 4 or 8 bytes.
+	 *
+	 * `bool` is excluded: a stored byte other than 0 or 1 is not a valid `bool` value.
+	 */
+	template<typename T>
+	concept Numeric = (std::is_arithmetic_v<T> || std::is_enum_v<T>) && !std::same_as<std::remove_cv_t<T>, bool> &&
+		(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+	/**
+	 * @brief Maximum encoded size of a 64-bit LEB128 varint.
+	 */
+	constexpr std::size_t MaxVarintSize = 10;
+
+	/**
+	 * @brief Unsigned integer with the same size as `T`, used to swap its bytes.
+	 */
+	template<Numeric T>
+	using Bits = std::conditional_t<sizeof(T) == 1, std::uint8_t,
+				 std::conditional_t<sizeof(T) == 2, std::uint16_t,
+				 std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+	/**
+	 * @brief Decodes a value stored with the given byte order.
+	 * @param data Pointer to at least `sizeof(T)` bytes.
+	 * @param endian Byte order of the stored value.
+	 * @return The decoded value.
+	 */
+	template<Numeric T>
+	T 																		Load(const Byte* data, const std::endian& endian) noexcept {
+		Bits<T> bits;
+		std::memcpy(&bits, data, sizeof(T));
+		if (endian != std::endian::native) {
+			bits = std::byteswap(bits);
+		}
+		return std::bit_cast<T>(bits);
+	}
+
+	/**
+	 * @brief Encodes a value with the given byte order.
+	 * @param value Value to encode.
+	 * @param endian Byte order to store the value with.
+	 * @param data Pointer to at least `sizeof(T)` writable bytes.
+	 */
+	template<Numeric T>
+	void 																	Store(const T& value, const std::endian& endian, Byte* data) noexcept {
+		auto bits = std::bit_cast<Bits<T>>(value);
+		if (endian != std::endian::native) {
+			bits = std::byteswap(bits);
+		}
+		std::memcpy(data, &bits, sizeof(T));
+	}
+
+	/**
+	 * @brief Encodes an integer as a LEB128 varint.
+	 * @param value Value to encode; signed values are passed as their two's complement bits.
+	 * @param is_signed Whether to use the signed (sign extended) LEB128 variant.
+	 * @param data Pointer to at least `MaxVarintSize` writable bytes.
+	 * @return Number of bytes written.
+	 */
+	STORMBYTE_PUBLIC std::size_t 											EncodeVarint(std::uint64_t value, const bool& is_signed, Byte* data) noexcept;
+
+	/**
+	 * @brief Decodes a LEB128 varint from the start of a span.
+	 * @param data Bytes to decode from.
+	 * @param is_signed Whether to decode the signed (sign extended) LEB128 variant.
+	 * @param value Receives the decoded value; signed values as their two's complement bits.
+	 * @return Number of bytes consumed, or 0 if `data` does not start with a complete varint or its value
+	 * does not fit in 64 bits. When `data` holds `MaxVarintSize` bytes or more, 0 means the varint is
+	 * malformed rather than truncated.
+	 */
+	STORMBYTE_PUBLIC std::size_t 											DecodeVarint(const ConstByteSpan& data, const bool& is_signed, std::uint64_t& value) noexcept;
+}
\ No newline at end of file
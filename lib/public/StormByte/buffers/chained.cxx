@@ -0,0 +1,505 @@
+#include <StormByte/buffers/chained.hxx>
+#include <StormByte/buffers/hexdump.hxx>
+#include <StormByte/buffers/io.hxx>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+using namespace StormByte::Buffers;
+
+Chained::Chained() noexcept: m_segments(), m_head(0), m_size(0), m_position(0), m_cursor_segment(0), m_cursor_offset(0) {}
+
+Chained::Chained(const std::string& data): Chained() {
+	Append(reinterpret_cast<const std::byte*>(data.data()), data.size());
+}
+
+Chained::Chained(const Buffers::Data& data): Chained() {
+	Append(data.data(), data.size());
+}
+
+Chained::Chained(Buffers::Data&& data): Chained() {
+	if (!data.empty()) {
+		m_size = data.size();
+		m_segments.push_back(std::move(data));
+	}
+}
+
+Chained::Chained(const std::span<const Byte>& data): Chained() {
+	Append(data.data(), data.size());
+}
+
+Chained& Chained::operator<<(const Buffers::Data& data) {
+	Write(data);
+	return *this;
+}
+
+Chained& Chained::operator<<(Buffers::Data&& data) {
+	Write(std::move(data));
+	return *this;
+}
+
+Chained& Chained::operator<<(const Simple& buffer) {
+	Write(buffer);
+	return *this;
+}
+
+Chained& Chained::operator<<(const Chained& buffer) {
+	Write(buffer);
+	return *this;
+}
+
+Chained& Chained::operator<<(Chained&& buffer) {
+	Write(std::move(buffer));
+	return *this;
+}
+
+Chained& Chained::operator<<(const std::string& data) {
+	Write(data);
+	return *this;
+}
+
+std::size_t Chained::AvailableBytes() const noexcept {
+	return m_position < m_size ? m_size - m_position : 0;
+}
+
+void Chained::Clear() noexcept {
+	m_segments.clear();
+	m_head = 0;
+	m_size = 0;
+	m_position = 0;
+	ResetCursor();
+}
+
+StormByte::Buffers::Data Chained::Data() const {
+	Buffers::Data data(m_size);
+	CopyOut(0, m_size, data.data());
+	return data;
+}
+
+void Chained::Discard(const std::size_t& length, const Read::Position& mode) noexcept {
+	std::size_t discard_start = 0;
+
+	// Determine the starting position for the discard operation based on the mode
+	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Begin)) {
+		discard_start = 0; // Discard from the beginning
+	} else if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::End)) {
+		discard_start = (length > m_size) ? 0 : m_size - length; // Discard from the end
+	} else if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Relative)) {
+		discard_start = m_position; // Discard relative to the current position
+	} else if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Absolute)) {
+		discard_start = (length > m_size) ? m_size : 0; // Discard from the absolute position
+	}
+
+	// Ensure the discard range is valid
+	discard_start = std::min(discard_start, m_size);
+	const std::size_t discard_end = std::min(discard_start + length, m_size);
+
+	// Perform the discard operation
+	if (discard_start < discard_end) {
+		Remove(discard_start, discard_end);
+	}
+
+	// Adjust the read position if necessary
+	if (m_position >= discard_end) {
+		m_position -= (discard_end - discard_start); // Adjust position if it's after the discarded range
+	} else if (m_position >= discard_start) {
+		m_position = discard_start; // Adjust position to the start of the discarded range
+	}
+}
+
+bool Chained::Empty() const noexcept {
+	return m_size == 0;
+}
+
+bool Chained::End() const noexcept {
+	return m_position == m_size;
+}
+
+ExpectedData<BufferOverflow> Chained::Extract(const std::size_t& length) {
+	if (!HasEnoughData(length)) {
+		return StormByte::Unexpected<BufferOverflow>(
+			"Insufficient data to read {} bytes (only have {} bytes)", length, AvailableBytes()
+		);
+	}
+
+	// Whole first segment: hand it over as is
+	if (m_position == 0 && m_head == 0 && length > 0 && m_segments.front().size() == length) {
+		Buffers::Data extracted_data = std::move(m_segments.front());
+		m_segments.pop_front();
+		m_size -= length;
+		ResetCursor();
+		return extracted_data;
+	}
+
+	Buffers::Data extracted_data(length);
+	CopyOut(m_position, length, extracted_data.data());
+	Discard(length, Read::Position::Relative);
+
+	return extracted_data;
+}
+
+Read::Status Chained::ExtractInto(const std::size_t& length, Chained& output) {
+	if (this == &output || !HasEnoughData(length)) {
+		return Read::Status::Error;
+	}
+
+	if (m_position != 0) {
+		Buffers::Data extracted_data(length);
+		CopyOut(m_position, length, extracted_data.data());
+		output.Adopt(std::move(extracted_data));
+		Discard(length, Read::Position::Relative);
+		return Read::Status::Success;
+	}
+
+	// Relink every whole segment, copy only the partially covered ones
+	std::size_t remaining = length;
+	while (remaining > 0) {
+		auto& front = m_segments.front();
+		const std::size_t live = front.size() - m_head;
+		if (m_head == 0 && remaining >= live) {
+			output.Adopt(std::move(front));
+			m_segments.pop_front();
+			remaining -= live;
+			m_size -= live;
+		} else {
+			const std::size_t take = std::min(live, remaining);
+			output.Append(front.data() + m_head, take);
+			m_head += take;
+			m_size -= take;
+			remaining -= take;
+			if (m_head == front.size()) {
+				m_segments.pop_front();
+				m_head = 0;
+			}
+		}
+	}
+	ResetCursor();
+
+	return Read::Status::Success;
+}
+
+Read::Status Chained::ExtractInto(const std::size_t& length, Simple& output) {
+	if (!HasEnoughData(length)) {
+		return Read::Status::Error;
+	}
+
+	if (length > 0) {
+		auto [index, offset] = Locate(m_position);
+		std::size_t remaining = length;
+		while (remaining > 0) {
+			const auto& segment = m_segments[index];
+			const std::size_t take = std::min(segment.size() - offset, remaining);
+			output.Append(segment.data() + offset, take);
+			remaining -= take;
+			++index;
+			offset = 0;
+		}
+	}
+	Discard(length, Read::Position::Relative);
+
+	return Read::Status::Success;
+}
+
+bool Chained::HasEnoughData(const std::size_t& length) const noexcept {
+	return m_position + length <= m_size;
+}
+
+std::string Chained::HexData(const std::size_t& column_size) const {
+	return HexDump::Encode(Span(), column_size);
+}
+
+bool Chained::IsEoF() const noexcept {
+	return m_position >= m_size;
+}
+
+ExpectedByte<BufferOverflow> Chained::Peek() const {
+	if (m_position >= m_size) {
+		return StormByte::Unexpected<BufferOverflow>(
+			"Cannot peek: no more data available in the buffer."
+		);
+	}
+	auto [index, offset] = Locate(m_position);
+	return m_segments[index][offset];
+}
+
+std::size_t Chained::Position() const noexcept {
+	return m_position;
+}
+
+ExpectedData<BufferOverflow> Chained::Read(const std::size_t& length) const {
+	if (!HasEnoughData(length)) {
+		return StormByte::Unexpected<BufferOverflow>(
+			"Insufficient data to read {} bytes (only have {} bytes)",
+			length,
+			AvailableBytes());
+	}
+
+	Buffers::Data read_data(length);
+	CopyOut(m_position, length, read_data.data());
+	m_position += length;
+
+	return read_data;
+}
+
+StormByte::Expected<std::size_t, BufferIOError> Chained::ReadFrom(const int& fd, const std::size_t& max) {
+	// Fill the spare capacity of the tail segment before using a new one
+	Buffers::Data* back = m_segments.empty() ? nullptr : &m_segments.back();
+	const std::size_t back_size = back ? back->size() : 0;
+	const std::size_t spare = back ? std::min(back->capacity() - back_size, max) : 0;
+	if (spare > 0) {
+		back->resize(back_size + spare);
+	}
+	Buffers::Data segment(max - spare);
+
+	const std::array<ByteSpan, 2> regions {
+		ByteSpan(back ? back->data() + back_size : nullptr, spare),
+		ByteSpan(segment.data(), segment.size())
+	};
+	auto read = IO::Read(fd, regions);
+	const std::size_t count = read ? *read : 0;
+
+	if (back) {
+		back->resize(back_size + std::min(count, spare));
+	}
+	if (count > spare) {
+		segment.resize(count - spare);
+		m_segments.push_back(std::move(segment));
+	}
+	m_size += count;
+	return read;
+}
+
+void Chained::Seek(const std::ptrdiff_t& position, const Read::Position& mode) const {
+	std::size_t new_position = 0;
+
+	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Begin)) {
+		new_position = static_cast<std::size_t>(std::max<ptrdiff_t>(0, position));
+	}
+	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::End)) {
+		new_position = static_cast<std::size_t>(
+			std::max<ptrdiff_t>(0, static_cast<ptrdiff_t>(m_size) + position));
+	}
+	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Relative)) {
+		new_position = static_cast<std::size_t>(
+			std::max<ptrdiff_t>(0, static_cast<ptrdiff_t>(m_position) + position));
+	}
+	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Absolute)) {
+		new_position = static_cast<std::size_t>(std::max<ptrdiff_t>(0, position));
+	}
+
+	m_position = new_position;
+}
+
+std::size_t Chained::Segments() const noexcept {
+	return m_segments.size();
+}
+
+std::size_t Chained::Size() const noexcept {
+	return m_size;
+}
+
+std::span<const Byte> Chained::Span() const {
+	if (m_segments.empty()) {
+		return {};
+	}
+
+	if (m_segments.size() > 1) {
+		Buffers::Data merged;
+		merged.reserve(m_size);
+		for (std::size_t index = 0; index < m_segments.size(); ++index) {
+			const auto& segment = m_segments[index];
+			merged.insert(merged.end(), segment.begin() + (index == 0 ? m_head : 0), segment.end());
+		}
+		m_segments.clear();
+		m_segments.push_back(std::move(merged));
+		m_head = 0;
+		ResetCursor();
+	}
+
+	return std::span<const Byte>(m_segments.front().data() + m_head, m_size);
+}
+
+Write::Status Chained::Write(const Buffers::Data& data) {
+	Append(data.data(), data.size());
+	return Write::Status::Success;
+}
+
+Write::Status Chained::Write(Buffers::Data&& data) {
+	Adopt(std::move(data));
+	return Write::Status::Success;
+}
+
+Write::Status Chained::Write(const Simple& buffer) {
+	const auto span = buffer.Span();
+	Append(span.data(), span.size());
+	return Write::Status::Success;
+}
+
+Write::Status Chained::Write(const Chained& buffer) {
+	if (this == &buffer) {
+		return Write(Chained(buffer));
+	}
+	for (std::size_t index = 0; index < buffer.m_segments.size(); ++index) {
+		const auto& segment = buffer.m_segments[index];
+		const std::size_t skip = index == 0 ? buffer.m_head : 0;
+		Append(segment.data() + skip, segment.size() - skip);
+	}
+	return Write::Status::Success;
+}
+
+Write::Status Chained::Write(Chained&& buffer) {
+	if (this == &buffer) {
+		return Write(Chained(buffer));
+	}
+	for (std::size_t index = 0; index < buffer.m_segments.size(); ++index) {
+		auto& segment = buffer.m_segments[index];
+		if (index == 0 && buffer.m_head > 0) {
+			Append(segment.data() + buffer.m_head, segment.size() - buffer.m_head);
+		} else {
+			Adopt(std::move(segment));
+		}
+	}
+	buffer.Clear();
+	return Write::Status::Success;
+}
+
+Write::Status Chained::Write(const std::string& data) {
+	Append(reinterpret_cast<const std::byte*>(data.data()), data.size());
+	return Write::Status::Success;
+}
+
+StormByte::Expected<std::size_t, BufferIOError> Chained::WriteTo(const int& fd) {
+	std::vector<ConstByteSpan> regions;
+	if (m_position < m_size) {
+		auto [index, at] = Locate(m_position);
+		regions.reserve(m_segments.size() - index);
+		for (; index < m_segments.size(); ++index, at = 0) {
+			regions.emplace_back(m_segments[index].data() + at, m_segments[index].size() - at);
+		}
+	}
+
+	auto written = IO::Write(fd, regions);
+	if (written && *written > 0) {
+		Discard(*written, Read::Position::Relative);
+	}
+	return written;
+}
+
+void Chained::Append(const Byte* data, const std::size_t& length) {
+	if (length == 0) {
+		return;
+	}
+
+	// Coalesce into the tail while it does not force copying a large segment around
+	if (!m_segments.empty()) {
+		auto& back = m_segments.back();
+		if (back.size() + length <= back.capacity() || (back.size() < CoalesceThreshold && length < CoalesceThreshold)) {
+			back.insert(back.end(), data, data + length);
+			m_size += length;
+			return;
+		}
+	}
+
+	Buffers::Data segment;
+	segment.reserve(std::max(length, CoalesceThreshold));
+	segment.insert(segment.end(), data, data + length);
+	m_segments.push_back(std::move(segment));
+	m_size += length;
+}
+
+void Chained::Adopt(Buffers::Data&& data) {
+	if (data.size() < CoalesceThreshold) {
+		Append(data.data(), data.size());
+		return;
+	}
+	m_size += data.size();
+	m_segments.push_back(std::move(data));
+}
+
+void Chained::CopyOut(std::size_t offset, std::size_t length, Byte* output) const noexcept {
+	if (length == 0) {
+		return;
+	}
+	auto [index, at] = Locate(offset);
+	while (length > 0) {
+		const auto& segment = m_segments[index];
+		const std::size_t take = std::min(segment.size() - at, length);
+		std::memcpy(output, segment.data() + at, take);
+		output += take;
+		length -= take;
+		++index;
+		at = 0;
+	}
+}
+
+std::pair<std::size_t, std::size_t> Chained::Locate(const std::size_t& offset) const noexcept {
+	if (offset < m_cursor_offset) {
+		ResetCursor();
+	}
+
+	std::size_t index = m_cursor_segment;
+	std::size_t start = m_cursor_offset;
+	while (true) {
+		const std::size_t skip = index == 0 ? m_head : 0;
+		const std::size_t length = m_segments[index].size() - skip;
+		if (offset < start + length) {
+			m_cursor_segment = index;
+			m_cursor_offset = start;
+			return { index, skip + (offset - start) };
+		}
+		start += length;
+		++index;
+	}
+}
+
+void Chained::Remove(const std::size_t& start, const std::size_t& end) noexcept {
+	if (end - start == m_size) {
+		m_segments.clear();
+		m_head = 0;
+		m_size = 0;
+		ResetCursor();
+		return;
+	}
+
+	if (start == 0) {
+		// Front removal drops whole segments and advances the head of the next one
+		std::size_t remaining = end;
+		while (remaining > 0) {
+			auto& front = m_segments.front();
+			const std::size_t live = front.size() - m_head;
+			if (remaining >= live) {
+				remaining -= live;
+				m_segments.pop_front();
+				m_head = 0;
+			} else {
+				m_head += remaining;
+				remaining = 0;
+			}
+		}
+	} else {
+		auto [index, at] = Locate(start);
+		std::size_t remaining = end - start;
+		while (remaining > 0) {
+			auto& segment = m_segments[index];
+			const std::size_t take = std::min(segment.size() - at, remaining);
+			segment.erase(segment.begin() + at, segment.begin() + at + take);
+			remaining -= take;
+			if (segment.empty()) {
+				m_segments.erase(m_segments.begin() + index);
+			} else {
+				++index;
+			}
+			at = 0;
+		}
+	}
+
+	m_size -= end - start;
+	ResetCursor();
+}
+
+void Chained::ResetCursor() const noexcept {
+	m_cursor_segment = 0;
+	m_cursor_offset = 0;
+}
\ No newline at end of file
@@ -0,0 +1,416 @@
+#pragma once
+
+#include <StormByte/buffers/simple.hxx>
+
+#include <deque>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers {
+	/**
+	 * @class Chained
+	 * @brief A segmented byte buffer which adopts appended data instead of copying it.
+	 *
+	 * The `Chained` class stores its contents as a list of `Buffers::Data` segments. Moving a byte vector
+	 * into the buffer links it as a new segment in constant time, so building large payloads never
+	 * reallocates or copies what is already stored. Small writes are coalesced into the last segment
+	 * to keep the segment count low.
+	 *
+	 * **Key Features:**
+	 * - **Same API as `Simple`**: Supports appending, reading, extracting, peeking, seeking and hex dumps.
+	 * - **Constant Time Appends**: Moved byte vectors are adopted as segments without copying.
+	 * - **Whole Segment Hand-off**: Extracting a complete segment moves it out instead of copying it.
+	 * - **On Demand Linearization**: Contiguous views are only built when `Span` is requested.
+	 *
+	 * Like `Simple`, this class is not thread-safe.
+	 */
+	class STORMBYTE_PUBLIC Chained {
+		public:
+			/**
+			 * @brief Writes smaller than this are copied into the last segment instead of creating a new one.
+			 */
+			static constexpr std::size_t CoalesceThreshold = 1024;
+
+			/**
+			 * @brief Default constructor
+			 * Initializes an empty chained buffer.
+			 */
+			Chained() noexcept;
+
+			/**
+			 * @brief Constructor
+			 * @param data String to set as buffer content.
+			 */
+			Chained(const std::string& data);
+
+			/**
+			 * @brief Constructor
+			 * @param data Vector of bytes to set as buffer content.
+			 */
+			Chained(const Buffers::Data& data);
+
+			/**
+			 * @brief Constructor
+			 * @param data Vector of bytes to adopt as the first segment.
+			 */
+			Chained(Buffers::Data&& data);
+
+			/**
+			 * @brief Constructor
+			 * @param data Span of bytes to set as buffer content.
+			 */
+			Chained(const std::span<const Byte>& data);
+
+			/**
+			 * @brief Copy constructor
+			 * @param other Chained buffer to copy from.
+			 */
+			Chained(const Chained& other)											= default;
+
+			/**
+			 * @brief Move constructor
+			 * @param other Chained buffer to move from.
+			 */
+			Chained(Chained&& other) noexcept										= default;
+
+			/**
+			 * @brief Destructor
+			 */
+			virtual ~Chained() noexcept 											= default;
+
+			/**
+			 * @brief Copy assignment operator
+			 * @param other Chained buffer to copy from.
+			 * @return Reference to the updated chained buffer.
+			 */
+			Chained& operator=(const Chained& other)								= default;
+
+			/**
+			 * @brief Move assignment operator
+			 * @param other Chained buffer to move from.
+			 * @return Reference to the updated chained buffer.
+			 */
+			Chained& operator=(Chained&& other) noexcept							= default;
+
+			/**
+			 * @brief Appends a byte vector to the current chained buffer
+			 * @param data Byte vector to append.
+			 * @return Reference to the updated chained buffer.
+			 */
+			Chained& 																operator<<(const Buffers::Data& data);
+
+			/**
+			 * @brief Moves a byte vector into the current chained buffer
+			 * @param data Byte vector to adopt.
+			 * @return Reference to the updated chained buffer.
+			 */
+			Chained& 																operator<<(Buffers::Data&& data);
+
+			/**
+			 * @brief Appends a simple buffer to the current chained buffer
+			 * @param buffer Simple buffer to append.
+			 * @return Reference to the updated chained buffer.
+			 */
+			Chained& 																operator<<(const Simple& buffer);
+
+			/**
+			 * @brief Appends a chained buffer to the current chained buffer
+			 * @param buffer Chained buffer to append.
+			 * @return Reference to the updated chained buffer.
+			 */
+			Chained& 																operator<<(const Chained& buffer);
+
+			/**
+			 * @brief Moves the segments of a chained buffer into the current chained buffer
+			 * @param buffer Chained buffer to take the segments from.
+			 * @return Reference to the updated chained buffer.
+			 */
+			Chained& 																operator<<(Chained&& buffer);
+
+			/**
+			 * @brief Appends a string to the current chained buffer
+			 * @param data String to append.
+			 * @return Reference to the updated chained buffer.
+			 */
+			Chained& 																operator<<(const std::string& data);
+
+			/**
+			 * @brief Appends a numeric value to the current chained buffer.
+			 * @tparam NumericType The type of the numeric value to append.
+			 * @param value The numeric value to append.
+			 * @return Reference to the updated chained buffer.
+			 * @see Simple::operator<<
+			 */
+			template <typename NumericType, typename = std::enable_if_t<std::is_arithmetic_v<std::decay_t<NumericType>>>>
+			Chained& operator<<(const NumericType& value) {
+				Append(reinterpret_cast<const std::byte*>(&value), sizeof(NumericType));
+				return *this;
+			}
+
+			/**
+			 * @brief Gets the available bytes to read from current position
+			 * @return Number of bytes available to read.
+			 */
+			std::size_t 															AvailableBytes() const noexcept;
+
+			/**
+			 * @brief Clears the chained buffer
+			 * Removes all segments and resets the read position.
+			 */
+			void 																	Clear() noexcept;
+
+			/**
+			 * @brief Retrieves a contiguous copy of the buffer data.
+			 * @return A copy of the buffer data as a vector of bytes.
+			 */
+			Buffers::Data 															Data() const;
+
+			/**
+			 * @brief Discards data from the buffer.
+			 * @param length The number of bytes to discard.
+			 * @param mode The mode to use for discarding (default is `Read::Position::Relative`).
+			 * @see Simple::Discard
+			 */
+			void 																	Discard(const std::size_t& length, const Read::Position& mode = Read::Position::Relative) noexcept;
+
+			/**
+			 * @brief Checks if the chained buffer is empty
+			 * @return True if the chained buffer is empty, false otherwise.
+			 */
+			bool 																	Empty() const noexcept;
+
+			/**
+			 * @brief Checks if the read position is at the end
+			 * @return True if the read position is at the end, false otherwise.
+			 */
+			bool 																	End() const noexcept;
+
+			/**
+			 * @brief Extracts a specific size of data, taking ownership of the read data and removing it from the chained buffer.
+			 *
+			 * When the requested range is exactly one whole segment it is moved out without copying.
+			 *
+			 * @param length Length of the data to read and remove from the chained buffer.
+			 * @return `ExpectedData` containing the requested data, or an `Unexpected` with a `BufferOverflow` error if
+			 *         insufficient data exists.
+			 */
+			ExpectedData<BufferOverflow> 											Extract(const std::size_t& length);
+
+			/**
+			 * @brief Extracts a specific size of data into another chained buffer.
+			 *
+			 * Whole segments inside the range are relinked into the output; only partially covered
+			 * segments are copied.
+			 *
+			 * @param length Length of the data to extract.
+			 * @param output Chained buffer receiving the extracted data.
+			 * @return `Read::Status` indicating the success or failure of the operation.
+			 */
+			Read::Status 															ExtractInto(const std::size_t& length, Chained& output);
+
+			/**
+			 * @brief Extracts a specific size of data into a simple buffer.
+			 * @param length Length of the data to extract.
+			 * @param output Simple buffer receiving the extracted data.
+			 * @return `Read::Status` indicating the success or failure of the operation.
+			 */
+			Read::Status 															ExtractInto(const std::size_t& length, Simple& output);
+
+			/**
+			 * @brief Checks if the chained buffer has enough data starting from the current read position.
+			 * @param length Length of the data to check.
+			 * @return True if enough data is available, false otherwise.
+			 */
+			bool 																	HasEnoughData(const std::size_t& length) const noexcept;
+
+			/**
+			 * @brief Retrieves the stored value as a hexadecimal string.
+			 * @param column_size Number of bytes per column in the output. Defaults to 16.
+			 * @return Hexadecimal string representation of the stored value.
+			 * @see Simple::HexData
+			 */
+			std::string 															HexData(const std::size_t& column_size = 16) const;
+
+			/**
+			 * @brief Checks if the buffer is at the end of the data
+			 * @return True if the buffer is at the end, false otherwise.
+			 */
+			bool 																	IsEoF() const noexcept;
+
+			/**
+			 * @brief Retrieves the next byte without incrementing the read position.
+			 * @return `ExpectedByte` containing the next byte, or an `Unexpected`
+			 *         with a `BufferOverflow` error if there is no more data.
+			 */
+			ExpectedByte<BufferOverflow>											Peek() const;
+
+			/**
+			 * @brief Retrieves the read position
+			 * @return Current read position in the chained buffer.
+			 */
+			std::size_t 															Position() const noexcept;
+
+			/**
+			 * @brief Reads a specific size of data starting from the current read position.
+			 * @param length Length of the data to read.
+			 * @return `ExpectedData` containing a copy of the requested data, or an
+			 *         `Unexpected` with a `BufferOverflow` error if insufficient data exists.
+			 */
+			ExpectedData<BufferOverflow> 											Read(const std::size_t& length) const;
+
+			/**
+			 * @brief Reads from a file descriptor directly into the chained buffer.
+			 *
+			 * A single `readv` fills the spare capacity of the last segment first and a new segment
+			 * for the rest, so no temporary buffer is involved. Read bytes are appended at the end.
+			 *
+			 * @param fd File descriptor to read from.
+			 * @param max Maximum number of bytes to read.
+			 * @return Number of bytes read (0 at end of file), or a `BufferIOError` on failure.
+			 */
+			Expected<std::size_t, BufferIOError> 									ReadFrom(const int& fd, const std::size_t& max);
+
+			/**
+			 * @brief Moves the read pointer within the chained buffer.
+			 * @param position The position to move to, interpreted based on the specified mode.
+			 * @param mode The mode to use for seeking (e.g., `Begin`, `End`, `Relative`, `Absolute`).
+			 */
+			void 																	Seek(const std::ptrdiff_t& position, const Read::Position& mode) const;
+
+			/**
+			 * @brief Retrieves the number of segments currently stored
+			 * @return Number of segments.
+			 */
+			std::size_t 															Segments() const noexcept;
+
+			/**
+			 * @brief Retrieves the length of the chained buffer
+			 * @return Length of the chained buffer.
+			 */
+			std::size_t 															Size() const noexcept;
+
+			/**
+			 * @brief Retrieves a contiguous read-only view of the stored value.
+			 *
+			 * If the data spans more than one segment, the segments are merged into a single one first.
+			 * This is the only operation which linearizes the buffer.
+			 *
+			 * @return A read-only span of the stored value.
+			 * @note Modifying the buffer invalidates the returned span. Although `const`, merging replaces
+			 * the segments, so it also invalidates the spans returned by earlier calls.
+			 */
+			std::span<const Byte> 													Span() const;
+
+			/**
+			 * @brief Writes a byte vector to the current chained buffer.
+			 * @param data Byte vector to write.
+			 * @return Write::Status of the operation.
+			 */
+			Write::Status 															Write(const Buffers::Data& data);
+
+			/**
+			 * @brief Moves a byte vector into the current chained buffer, adopting it as a segment.
+			 * @param data Byte vector to adopt.
+			 * @return Write::Status of the operation.
+			 */
+			Write::Status 															Write(Buffers::Data&& data);
+
+			/**
+			 * @brief Writes a simple buffer to the current chained buffer.
+			 * @param buffer Simple buffer to write.
+			 * @return Write::Status of the operation.
+			 */
+			Write::Status 															Write(const Simple& buffer);
+
+			/**
+			 * @brief Writes a chained buffer to the current chained buffer.
+			 * @param buffer Chained buffer to write.
+			 * @return Write::Status of the operation.
+			 */
+			Write::Status 															Write(const Chained& buffer);
+
+			/**
+			 * @brief Moves the segments of a chained buffer into the current chained buffer.
+			 * @param buffer Chained buffer to take the segments from.
+			 * @return Write::Status of the operation.
+			 */
+			Write::Status 															Write(Chained&& buffer);
+
+			/**
+			 * @brief Writes a string to the current chained buffer.
+			 * @param data String to write.
+			 * @return Write::Status of the operation.
+			 */
+			Write::Status 															Write(const std::string& data);
+
+			/**
+			 * @brief Writes the unread data to a file descriptor with scatter-gather I/O.
+			 *
+			 * Every segment from the read position onwards is handed to `writev` at once, without
+			 * linearizing. Written bytes are removed from the buffer.
+			 *
+			 * @param fd File descriptor to write to.
+			 * @return Number of bytes written, or a `BufferIOError` if nothing could be written.
+			 * @see Simple::WriteTo
+			 */
+			Expected<std::size_t, BufferIOError> 									WriteTo(const int& fd);
+
+		protected:
+			mutable std::deque<Buffers::Data> m_segments;							///< Stored segments (mutable so `Span` can linearize).
+			mutable std::size_t m_head;												///< Consumed bytes at the front of the first segment.
+			std::size_t m_size;														///< Total live bytes.
+			mutable std::size_t m_position;											///< Read position.
+			mutable std::size_t m_cursor_segment;									///< Segment index of the cached lookup.
+			mutable std::size_t m_cursor_offset;									///< Logical offset where the cached segment starts.
+
+			/**
+			 * @brief Appends raw bytes, coalescing them into the last segment when small.
+			 * @param data Pointer to the bytes to append.
+			 * @param length Number of bytes to append.
+			 */
+			void 																	Append(const Byte* data, const std::size_t& length);
+
+			/**
+			 * @brief Adopts a byte vector as a new segment, or coalesces it when small.
+			 * @param data Byte vector to adopt.
+			 */
+			void 																	Adopt(Buffers::Data&& data);
+
+			/**
+			 * @brief Copies the live range `[offset, offset + length)` into `output`.
+			 * @param offset Logical offset of the first byte.
+			 * @param length Number of bytes to copy.
+			 * @param output Destination, must hold at least `length` bytes.
+			 */
+			void 																	CopyOut(std::size_t offset, std::size_t length, Byte* output) const noexcept;
+
+			/**
+			 * @brief Finds the segment holding a logical offset.
+			 * @param offset Logical offset, must be lower than `m_size`.
+			 * @return Pair of segment index and byte index inside that segment's vector.
+			 */
+			std::pair<std::size_t, std::size_t> 									Locate(const std::size_t& offset) const noexcept;
+
+			/**
+			 * @brief Removes the live range `[start, end)` without touching the read position.
+			 * @param start First byte to remove.
+			 * @param end One past the last byte to remove.
+			 */
+			void 																	Remove(const std::size_t& start, const std::size_t& end) noexcept;
+
+			/**
+			 * @brief Drops the cached segment lookup after the segment list changed at the front.
+			 */
+			void 																	ResetCursor() const noexcept;
+	};
+}
\ No newline at end of file
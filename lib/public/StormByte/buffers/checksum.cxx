@@ -0,0 +1,296 @@
+#include <StormByte/buffers/checksum.hxx>
+#include <StormByte/buffers/consumer.hxx>
+#include <StormByte/buffers/cpu.hxx>
+#include <StormByte/buffers/producer.hxx>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if !defined(STORMBYTE_BUFFERS_X86) && defined(__ARM_FEATURE_CRC32)
+#define STORMBYTE_CRC32C_ARM
+#include <arm_acle.h>
+#endif
+
+using namespace StormByte::Buffers;
+
+namespace {
+	constexpr std::uint32_t Polynomial = 0x82F63B78; // Castagnoli, reflected
+
+	// Slicing-by-8: Tables[k][b] is the CRC of byte b followed by k zero bytes
+	constexpr std::array<std::array<std::uint32_t, 256>, 8> Tables = [] {
+		std::array<std::array<std::uint32_t, 256>, 8> tables {};
+		for (std::uint32_t byte = 0; byte < 256; byte++) {
+			std::uint32_t crc = byte;
+			for (int bit = 0; bit < 8; bit++) {
+				crc = (crc >> 1) ^ ((crc & 1) ? Polynomial : 0);
+			}
+			tables[0][byte] = crc;
+		}
+		for (std::size_t table = 1; table < 8; table++) {
+			for (std::size_t byte = 0; byte < 256; byte++) {
+				const std::uint32_t previous = tables[table - 1][byte];
+				tables[table][byte] = (previous >> 8) ^ tables[0][previous & 0xFF];
+			}
+		}
+		return tables;
+	}();
+
+	std::uint64_t LoadLittle64(const Byte* data) noexcept {
+		std::uint64_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return std::endian::native == std::endian::little ? value : std::byteswap(value);
+	}
+
+	std::uint32_t LoadLittle32(const Byte* data) noexcept {
+		std::uint32_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return std::endian::native == std::endian::little ? value : std::byteswap(value);
+	}
+
+	std::uint32_t CRC32CTable(std::uint32_t crc, const Byte* data, std::size_t length) noexcept {
+		for (; length >= 8; data += 8, length -= 8) {
+			const std::uint64_t word = LoadLittle64(data) ^ crc;
+			crc = Tables[7][word & 0xFF] ^ Tables[6][(word >> 8) & 0xFF] ^
+				  Tables[5][(word >> 16) & 0xFF] ^ Tables[4][(word >> 24) & 0xFF] ^
+				  Tables[3][(word >> 32) & 0xFF] ^ Tables[2][(word >> 40) & 0xFF] ^
+				  Tables[1][(word >> 48) & 0xFF] ^ Tables[0][word >> 56];
+		}
+		for (; length > 0; data++, length--) {
+			crc = (crc >> 8) ^ Tables[0][(crc ^ static_cast<std::uint8_t>(*data)) & 0xFF];
+		}
+		return crc;
+	}
+
+	#ifdef STORMBYTE_BUFFERS_X86
+	SSE42_TARGET std::uint32_t CRC32CHardware(std::uint32_t crc, const Byte* data, std::size_t length) noexcept {
+		#if defined(__x86_64__) || defined(_M_X64)
+		std::uint64_t crc64 = crc;
+		for (; length >= 8; data += 8, length -= 8) {
+			crc64 = _mm_crc32_u64(crc64, LoadLittle64(data));
+		}
+		crc = static_cast<std::uint32_t>(crc64);
+		#endif
+		for (; length >= 4; data += 4, length -= 4) {
+			crc = _mm_crc32_u32(crc, LoadLittle32(data));
+		}
+		for (; length > 0; data++, length--) {
+			crc = _mm_crc32_u8(crc, static_cast<std::uint8_t>(*data));
+		}
+		return crc;
+	}
+	#elif defined(STORMBYTE_CRC32C_ARM)
+	std::uint32_t CRC32CHardware(std::uint32_t crc, const Byte* data, std::size_t length) noexcept {
+		for (; length >= 8; data += 8, length -= 8) {
+			crc = __crc32cd(crc, LoadLittle64(data));
+		}
+		for (; length > 0; data++, length--) {
+			crc = __crc32cb(crc, static_cast<std::uint8_t>(*data));
+		}
+		return crc;
+	}
+	#endif
+
+	// xxHash64 primes
+	constexpr std::uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+	constexpr std::uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+	constexpr std::uint64_t Prime3 = 0x165667B19E3779F9ULL;
+	constexpr std::uint64_t Prime4 = 0x85EBCA77C2B2AE63ULL;
+	constexpr std::uint64_t Prime5 = 0x27D4EB2F165667C5ULL;
+
+	std::uint64_t Round(std::uint64_t accumulator, const std::uint64_t& input) noexcept {
+		accumulator += input * Prime2;
+		return std::rotl(accumulator, 31) * Prime1;
+	}
+
+	std::uint64_t Merge(std::uint64_t hash, const std::uint64_t& accumulator) noexcept {
+		hash ^= Round(0, accumulator);
+		return hash * Prime1 + Prime4;
+	}
+
+	// Bytes a trailer takes for each algorithm
+	std::size_t TrailerSize(const Checksum::Algorithm& algorithm) noexcept {
+		return algorithm == Checksum::Algorithm::CRC32C ? sizeof(std::uint32_t) : sizeof(std::uint64_t);
+	}
+
+	// Running checksum of either algorithm, shared by the trailer pipes
+	class Running {
+		public:
+			explicit Running(const Checksum::Algorithm& algorithm) noexcept: m_algorithm(algorithm), m_crc(0), m_hash() {}
+
+			void Update(const ConstByteSpan& data) noexcept {
+				if (m_algorithm == Checksum::Algorithm::CRC32C) {
+					m_crc = Checksum::CRC32C(data, m_crc);
+				} else {
+					m_hash.Update(data);
+				}
+			}
+
+			Write::Status Append(Producer& output) const {
+				if (m_algorithm == Checksum::Algorithm::CRC32C) {
+					return output.WriteAs(m_crc, std::endian::big);
+				}
+				return output.WriteAs(m_hash.Value(), std::endian::big);
+			}
+
+			bool Matches(Consumer& input) const {
+				if (m_algorithm == Checksum::Algorithm::CRC32C) {
+					auto trailer = input.ReadAs<std::uint32_t>(std::endian::big);
+					return trailer && *trailer == m_crc;
+				}
+				auto trailer = input.ReadAs<std::uint64_t>(std::endian::big);
+				return trailer && *trailer == m_hash.Value();
+			}
+
+		private:
+			Checksum::Algorithm m_algorithm;
+			std::uint32_t m_crc;
+			Checksum::Hash64 m_hash;
+	};
+}
+
+std::uint32_t Checksum::CRC32C(const ConstByteSpan& data, const std::uint32_t& crc) noexcept {
+	const std::uint32_t state = ~crc;
+	#ifdef STORMBYTE_BUFFERS_X86
+	if (CPU::HasSSE42()) {
+		return ~CRC32CHardware(state, data.data(), data.size());
+	}
+	#elif defined(STORMBYTE_CRC32C_ARM)
+	return ~CRC32CHardware(state, data.data(), data.size());
+	#endif
+	return ~CRC32CTable(state, data.data(), data.size());
+}
+
+std::uint32_t Checksum::CRC32C(const Simple& buffer) noexcept {
+	return CRC32C(buffer.Span().subspan(buffer.Position()));
+}
+
+std::uint64_t Checksum::Hash(const ConstByteSpan& data, const std::uint64_t& seed) noexcept {
+	Hash64 hash(seed);
+	hash.Update(data);
+	return hash.Value();
+}
+
+std::uint64_t Checksum::Hash(const Simple& buffer, const std::uint64_t& seed) noexcept {
+	return Hash(buffer.Span().subspan(buffer.Position()), seed);
+}
+
+Checksum::Hash64::Hash64(const std::uint64_t& seed) noexcept {
+	Reset(seed);
+}
+
+void Checksum::Hash64::Reset(const std::uint64_t& seed) noexcept {
+	m_accumulators = { seed + Prime1 + Prime2, seed + Prime2, seed, seed - Prime1 };
+	m_pending_size = 0;
+	m_length = 0;
+	m_seed = seed;
+}
+
+void Checksum::Hash64::Update(const ConstByteSpan& data) noexcept {
+	const Byte* input = data.data();
+	std::size_t length = data.size();
+	m_length += length;
+
+	// Complete a pending stripe first
+	if (m_pending_size > 0) {
+		const std::size_t take = std::min(length, m_pending.size() - m_pending_size);
+		std::memcpy(m_pending.data() + m_pending_size, input, take);
+		m_pending_size += take;
+		input += take;
+		length -= take;
+		if (m_pending_size < m_pending.size()) {
+			return;
+		}
+		for (std::size_t lane = 0; lane < 4; lane++) {
+			m_accumulators[lane] = Round(m_accumulators[lane], LoadLittle64(m_pending.data() + 8 * lane));
+		}
+		m_pending_size = 0;
+	}
+
+	// Whole stripes straight from the input
+	for (; length >= 32; input += 32, length -= 32) {
+		for (std::size_t lane = 0; lane < 4; lane++) {
+			m_accumulators[lane] = Round(m_accumulators[lane], LoadLittle64(input + 8 * lane));
+		}
+	}
+
+	std::memcpy(m_pending.data(), input, length);
+	m_pending_size = length;
+}
+
+std::uint64_t Checksum::Hash64::Value() const noexcept {
+	std::uint64_t hash;
+	if (m_length >= 32) {
+		hash = std::rotl(m_accumulators[0], 1) + std::rotl(m_accumulators[1], 7) +
+			   std::rotl(m_accumulators[2], 12) + std::rotl(m_accumulators[3], 18);
+		for (const auto& accumulator : m_accumulators) {
+			hash = Merge(hash, accumulator);
+		}
+	} else {
+		hash = m_seed + Prime5;
+	}
+	hash += m_length;
+
+	const Byte* input = m_pending.data();
+	std::size_t length = m_pending_size;
+	for (; length >= 8; input += 8, length -= 8) {
+		hash ^= Round(0, LoadLittle64(input));
+		hash = std::rotl(hash, 27) * Prime1 + Prime4;
+	}
+	if (length >= 4) {
+		hash ^= static_cast<std::uint64_t>(LoadLittle32(input)) * Prime1;
+		hash = std::rotl(hash, 23) * Prime2 + Prime3;
+		input += 4;
+		length -= 4;
+	}
+	for (; length > 0; input++, length--) {
+		hash ^= static_cast<std::uint8_t>(*input) * Prime5;
+		hash = std::rotl(hash, 11) * Prime1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= Prime2;
+	hash ^= hash >> 29;
+	hash *= Prime3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+PipeFunction Checksum::AppendTrailer(const Algorithm& algorithm) {
+	return [algorithm](Consumer input, Producer output) {
+		Running checksum(algorithm);
+		while (!input.IsEoF()) {
+			// Forward whatever arrived, waiting for at least one byte
+			auto chunk = input.Extract(std::max<std::size_t>(input.AvailableBytes(), 1));
+			if (!chunk) {
+				break;
+			}
+			checksum.Update(*chunk);
+			output.Write(std::move(*chunk));
+		}
+		if (input.Status() == Status::Error) {
+			output << Status::Error;
+			return;
+		}
+		checksum.Append(output);
+		output << Status::ReadOnly;
+	};
+}
+
+PipeFunction Checksum::VerifyTrailer(const Algorithm& algorithm) {
+	return [algorithm](Consumer input, Producer output) {
+		Running checksum(algorithm);
+		const std::size_t trailer = TrailerSize(algorithm);
+		// Everything but the last `trailer` bytes is payload: wait until more than that is stored
+		while (input.PeekView(trailer + 1)) {
+			auto chunk = input.Extract(input.AvailableBytes() - trailer);
+			if (!chunk) {
+				break;
+			}
+			checksum.Update(*chunk);
+			output.Write(std::move(*chunk));
+		}
+		const bool valid = input.Status() != Status::Error && input.AvailableBytes() == trailer && checksum.Matches(input);
+		output << (valid ? Status::ReadOnly : Status::Error);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers::Checksum {
+	/**
+	 * @enum Algorithm
+	 * @brief Checksums available for pipeline trailers.
+	 */
+	enum class Algorithm: unsigned short {
+		CRC32C,																		///< CRC-32C (Castagnoli), 4 byte trailer.
+		Hash64																		///< 64-bit xxHash64 compatible hash, 8 byte trailer.
+	};
+
+	/**
+	 * @brief Computes or continues a CRC-32C (Castagnoli) checksum.
+	 *
+	 * Uses the SSE4.2 `crc32` instruction when the processor supports it (or the ARMv8 CRC extension
+	 * when compiled for it) and a slicing-by-8 table otherwise.
+	 *
+	 * @param data Bytes to checksum.
+	 * @param crc Checksum of the preceding bytes, 0 to start a new checksum.
+	 * @return Checksum of the preceding bytes followed by `data`.
+	 */
+	STORMBYTE_PUBLIC std::uint32_t 											CRC32C(const ConstByteSpan& data, const std::uint32_t& crc = 0) noexcept;
+
+	/**
+	 * @brief Computes the CRC-32C of the unread data of a buffer without copying it.
+	 * @param buffer Buffer to checksum; `Shared` buffers must not be written meanwhile.
+	 * @return The checksum.
+	 */
+	STORMBYTE_PUBLIC std::uint32_t 											CRC32C(const Simple& buffer) noexcept;
+
+	/**
+	 * @brief Computes a 64-bit hash in one pass.
+	 * @param data Bytes to hash.
+	 * @param seed Hash seed.
+	 * @return The hash, identical to xxHash64 with the same seed.
+	 */
+	STORMBYTE_PUBLIC std::uint64_t 											Hash(const ConstByteSpan& data, const std::uint64_t& seed = 0) noexcept;
+
+	/**
+	 * @brief Computes the 64-bit hash of the unread data of a buffer without copying it.
+	 * @param buffer Buffer to hash; `Shared` buffers must not be written meanwhile.
+	 * @param seed Hash seed.
+	 * @return The hash.
+	 */
+	STORMBYTE_PUBLIC std::uint64_t 											Hash(const Simple& buffer, const std::uint64_t& seed = 0) noexcept;
+
+	/**
+	 * @class Hash64
+	 * @brief Incremental 64-bit hash over chunked data.
+	 *
+	 * Feeding the data in any number of chunks gives the same value as `Checksum::Hash` over the whole data.
+	 */
+	class STORMBYTE_PUBLIC Hash64 final {
+		public:
+			/**
+			 * @brief Constructor
+			 * @param seed Hash seed.
+			 */
+			explicit Hash64(const std::uint64_t& seed = 0) noexcept;
+
+			/**
+			 * @brief Restarts the hash
+			 * @param seed Hash seed.
+			 */
+			void 															Reset(const std::uint64_t& seed = 0) noexcept;
+
+			/**
+			 * @brief Adds the next chunk of data
+			 * @param data Bytes to hash.
+			 */
+			void 															Update(const ConstByteSpan& data) noexcept;
+
+			/**
+			 * @brief Retrieves the hash of the data added so far
+			 * @return The hash.
+			 */
+			std::uint64_t 													Value() const noexcept;
+
+		private:
+			std::array<std::uint64_t, 4> m_accumulators;					///< Lane accumulators.
+			std::array<Byte, 32> m_pending;									///< Bytes waiting for a full stripe.
+			std::size_t m_pending_size;										///< Bytes used in `m_pending`.
+			std::uint64_t m_length;											///< Total bytes added.
+			std::uint64_t m_seed;											///< Hash seed.
+	};
+
+	/**
+	 * @brief Creates a pipe forwarding its input and appending a checksum trailer.
+	 *
+	 * The checksum of everything forwarded is written big endian once the input closes. If the input
+	 * ends in error, no trailer is written and the output is set to `Status::Error`.
+	 *
+	 * @param algorithm Checksum to append.
+	 * @return The pipe function.
+	 */
+	STORMBYTE_PUBLIC PipeFunction 											AppendTrailer(const Algorithm& algorithm);
+
+	/**
+	 * @brief Creates a pipe forwarding its input without the checksum trailer written by `AppendTrailer`.
+	 *
+	 * The data is forwarded as it arrives, holding back only the trailer size. The output is closed with
+	 * `Status::ReadOnly` if the trailer matches, and with `Status::Error` otherwise.
+	 *
+	 * @param algorithm Checksum to verify.
+	 * @return The pipe function.
+	 */
+	STORMBYTE_PUBLIC PipeFunction 											VerifyTrailer(const Algorithm& algorithm);
+}
\ No newline at end of file
@@ -0,0 +1,284 @@
+#include <StormByte/buffers/binary.hxx>
+#include <StormByte/buffers/compression.hxx>
+#include <StormByte/buffers/consumer.hxx>
+#include <StormByte/buffers/producer.hxx>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+using namespace StormByte::Buffers;
+
+namespace {
+	constexpr std::size_t MinMatch = 4;
+	constexpr std::size_t MaxOffset = 0xFFFF;
+	constexpr std::size_t LastLiterals = 5;									// Bytes always emitted as literals at the end
+	constexpr std::size_t MatchLimit = 12;									// No match starts in the last bytes
+	constexpr unsigned HashBits = 14;
+	constexpr unsigned SkipShift = 6;										// Probe step grows every 64 misses
+	constexpr std::size_t MaxRatio = 255;									// Best case expansion of one encoded byte
+
+	std::uint32_t Load32(const Byte* data) noexcept {
+		std::uint32_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	std::uint64_t Load64(const Byte* data) noexcept {
+		std::uint64_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	std::uint32_t HashOf(const std::uint32_t& sequence) noexcept {
+		return (sequence * 2654435761u) >> (32 - HashBits);
+	}
+
+	// Length of the common prefix of two positions, up to `limit` bytes
+	std::size_t MatchLength(const Byte* first, const Byte* second, const std::size_t& limit) noexcept {
+		std::size_t length = 0;
+		for (; length + sizeof(std::uint64_t) <= limit; length += sizeof(std::uint64_t)) {
+			const std::uint64_t difference = Load64(first + length) ^ Load64(second + length);
+			if (difference != 0) {
+				const int bits = std::endian::native == std::endian::little ? std::countr_zero(difference) : std::countl_zero(difference);
+				return length + static_cast<std::size_t>(bits) / 8;
+			}
+		}
+		while (length < limit && first[length] == second[length]) {
+			length++;
+		}
+		return length;
+	}
+
+	// Writes the 255-run continuation of a length whose token nibble saturated
+	Byte* WriteLength(Byte* output, std::size_t length) noexcept {
+		for (; length >= 255; length -= 255) {
+			*output++ = Byte{255};
+		}
+		*output++ = static_cast<Byte>(length);
+		return output;
+	}
+
+	Byte* WriteSequence(Byte* output, const Byte* literals, const std::size_t& literal_length, const std::size_t& offset, const std::size_t& match_length) noexcept {
+		Byte* token = output++;
+		std::uint8_t value = static_cast<std::uint8_t>(std::min<std::size_t>(literal_length, 15) << 4);
+		if (literal_length >= 15) {
+			output = WriteLength(output, literal_length - 15);
+		}
+		std::memcpy(output, literals, literal_length);
+		output += literal_length;
+		if (match_length > 0) {
+			Binary::Store(static_cast<std::uint16_t>(offset), std::endian::little, output);
+			output += sizeof(std::uint16_t);
+			const std::size_t extra = match_length - MinMatch;
+			value |= static_cast<std::uint8_t>(std::min<std::size_t>(extra, 15));
+			if (extra >= 15) {
+				output = WriteLength(output, extra - 15);
+			}
+		}
+		*token = static_cast<Byte>(value);
+		return output;
+	}
+
+	// Reads the continuation of a saturated length, false if it runs past the input or `limit`
+	bool ReadLength(const Byte*& input, const Byte* end, std::size_t& length, const std::size_t& limit) noexcept {
+		std::uint8_t value;
+		do {
+			if (input == end) {
+				return false;
+			}
+			value = static_cast<std::uint8_t>(*input++);
+			length += value;
+			if (length > limit) {
+				return false;
+			}
+		} while (value == 255);
+		return true;
+	}
+}
+
+std::size_t Compression::MaxCompressedSize(const std::size_t& length) noexcept {
+	return Binary::MaxVarintSize + length + length / 255 + 16;
+}
+
+StormByte::Buffers::Data Compression::Compress(const ConstByteSpan& data) {
+	Buffers::Data compressed(MaxCompressedSize(data.size()));
+	const Byte* input = data.data();
+	const std::size_t length = data.size();
+	Byte* output = compressed.data() + Binary::EncodeVarint(length, false, compressed.data());
+
+	std::size_t anchor = 0;
+	if (length > MatchLimit) {
+		std::array<std::uint32_t, std::size_t{1} << HashBits> table {};
+		const std::size_t limit = length - MatchLimit;
+		std::size_t position = 0, misses = 0;
+		while (position < limit) {
+			const std::uint32_t sequence = Load32(input + position);
+			const std::uint32_t hash = HashOf(sequence);
+			std::size_t candidate = table[hash];
+			table[hash] = static_cast<std::uint32_t>(position);
+			if (candidate >= position || position - candidate > MaxOffset || Load32(input + candidate) != sequence) {
+				position += 1 + (misses++ >> SkipShift);
+				continue;
+			}
+
+			// Extend the match backwards over pending literals, then forwards
+			while (position > anchor && candidate > 0 && input[position - 1] == input[candidate - 1]) {
+				position--;
+				candidate--;
+			}
+			const std::size_t match_length = MinMatch + MatchLength(input + position + MinMatch, input + candidate + MinMatch, length - LastLiterals - position - MinMatch);
+			output = WriteSequence(output, input + anchor, position - anchor, position - candidate, match_length);
+			position += match_length;
+			anchor = position;
+			misses = 0;
+			if (position < limit) {
+				table[HashOf(Load32(input + position - 2))] = static_cast<std::uint32_t>(position - 2);
+			}
+		}
+	}
+	output = WriteSequence(output, input + anchor, length - anchor, 0, 0);
+
+	compressed.resize(static_cast<std::size_t>(output - compressed.data()));
+	return compressed;
+}
+
+StormByte::Buffers::Simple Compression::Compress(const Simple& buffer) {
+	return Simple(Compress(buffer.Span().subspan(buffer.Position())));
+}
+
+StormByte::Buffers::ExpectedData<BufferCorrupted> Compression::Decompress(const ConstByteSpan& data) {
+	std::uint64_t size;
+	const std::size_t header = Binary::DecodeVarint(data, false, size);
+	if (header == 0) {
+		return StormByte::Unexpected<BufferCorrupted>("Compressed block has no valid length header");
+	}
+	// Also rejects lengths the payload can not possibly expand to before allocating them
+	if (size > (data.size() - header) * MaxRatio) {
+		return StormByte::Unexpected<BufferCorrupted>("Compressed block declares {} bytes from {} bytes of payload", size, data.size() - header);
+	}
+
+	Buffers::Data decompressed(static_cast<std::size_t>(size));
+	const Byte* input = data.data() + header;
+	const Byte* end = data.data() + data.size();
+	Byte* output = decompressed.data();
+	Byte* output_end = output + decompressed.size();
+
+	while (input < end) {
+		const auto token = static_cast<std::uint8_t>(*input++);
+
+		std::size_t literal_length = token >> 4;
+		if (literal_length == 15 && !ReadLength(input, end, literal_length, decompressed.size())) {
+			return StormByte::Unexpected<BufferCorrupted>("Truncated literal length");
+		}
+		if (literal_length > static_cast<std::size_t>(end - input) || literal_length > static_cast<std::size_t>(output_end - output)) {
+			return StormByte::Unexpected<BufferCorrupted>("Literal run of {} bytes overflows the block", literal_length);
+		}
+		std::memcpy(output, input, literal_length);
+		input += literal_length;
+		output += literal_length;
+		if (input == end) {
+			break;
+		}
+
+		if (end - input < 2) {
+			return StormByte::Unexpected<BufferCorrupted>("Truncated match offset");
+		}
+		const std::size_t offset = Binary::Load<std::uint16_t>(input, std::endian::little);
+		input += 2;
+		if (offset == 0 || offset > static_cast<std::size_t>(output - decompressed.data())) {
+			return StormByte::Unexpected<BufferCorrupted>("Match offset {} points outside the block", offset);
+		}
+
+		std::size_t match_length = token & 0x0F;
+		if (match_length == 15 && !ReadLength(input, end, match_length, decompressed.size())) {
+			return StormByte::Unexpected<BufferCorrupted>("Truncated match length");
+		}
+		match_length += MinMatch;
+		if (match_length > static_cast<std::size_t>(output_end - output)) {
+			return StormByte::Unexpected<BufferCorrupted>("Match of {} bytes overflows the block", match_length);
+		}
+
+		const Byte* match = output - offset;
+		if (offset >= match_length) {
+			std::memcpy(output, match, match_length);
+			output += match_length;
+		} else {
+			// Overlapping match repeats the last `offset` bytes
+			for (std::size_t i = 0; i < match_length; i++) {
+				*output++ = match[i];
+			}
+		}
+	}
+
+	if (output != output_end) {
+		return StormByte::Unexpected<BufferCorrupted>("Compressed block decodes to {} bytes instead of {}", output - decompressed.data(), decompressed.size());
+	}
+	return decompressed;
+}
+
+StormByte::Expected<StormByte::Buffers::Simple, BufferCorrupted> Compression::Decompress(const Simple& buffer) {
+	auto decompressed = Decompress(buffer.Span().subspan(buffer.Position()));
+	if (!decompressed) {
+		return StormByte::Unexpected(decompressed.error());
+	}
+	return Simple(std::move(decompressed.value()));
+}
+
+PipeFunction Compression::Compressor() {
+	return [](Consumer input, Producer output) {
+		while (true) {
+			std::size_t length = BlockSize;
+			// Wait for a whole block; a shorter one is only sent once the input is closed
+			if (!input.PeekView(BlockSize)) {
+				if (input.Status() == Status::Error) {
+					output << Status::Error;
+					return;
+				}
+				length = input.AvailableBytes();
+				if (length == 0) {
+					break;
+				}
+			}
+			auto block = input.Extract(length);
+			if (!block) {
+				output << Status::Error;
+				return;
+			}
+			auto compressed = Compress(ConstByteSpan(*block));
+			output.WriteVarint(static_cast<std::uint64_t>(compressed.size()));
+			output.Write(std::move(compressed));
+		}
+		output << Status::ReadOnly;
+	};
+}
+
+PipeFunction Compression::Decompressor() {
+	return [](Consumer input, Producer output) {
+		while (true) {
+			auto length = input.ReadVarint<std::uint64_t>();
+			if (!length) {
+				// A closed input with nothing left is the end of the last frame
+				const bool finished = input.Status() != Status::Error && input.AvailableBytes() == 0;
+				output << (finished ? Status::ReadOnly : Status::Error);
+				return;
+			}
+			if (*length > MaxCompressedSize(BlockSize)) {
+				output << Status::Error;
+				return;
+			}
+			auto frame = input.Extract(static_cast<std::size_t>(*length));
+			if (!frame) {
+				output << Status::Error;
+				return;
+			}
+			auto block = Decompress(ConstByteSpan(*frame));
+			if (!block) {
+				output << Status::Error;
+				return;
+			}
+			output.Write(std::move(*block));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <StormByte/buffers/exception.hxx>
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers::Compression {
+	/**
+	 * @brief Maximum uncompressed size of a frame written by the `Compressor` pipe.
+	 */
+	constexpr std::size_t BlockSize = 256 * 1024;
+
+	/**
+	 * @brief Computes the largest possible compressed size of a block.
+	 * @param length Uncompressed length.
+	 * @return Upper bound of `Compress` output for `length` bytes.
+	 */
+	STORMBYTE_PUBLIC std::size_t 											MaxCompressedSize(const std::size_t& length) noexcept;
+
+	/**
+	 * @brief Compresses a block with a byte oriented LZ77 encoder.
+	 *
+	 * The block starts with its uncompressed length as a varint followed by LZ4 style sequences
+	 * (literal run, 16-bit match offset, match length). Matches are found with a single hash probe
+	 * per position, trading ratio for throughput.
+	 *
+	 * @param data Bytes to compress.
+	 * @return The compressed block.
+	 */
+	STORMBYTE_PUBLIC Buffers::Data 											Compress(const ConstByteSpan& data);
+
+	/**
+	 * @brief Compresses the unread data of a buffer.
+	 * @param buffer Buffer to compress; `Shared` buffers must not be written meanwhile.
+	 * @return Buffer holding the compressed block.
+	 */
+	STORMBYTE_PUBLIC Simple 												Compress(const Simple& buffer);
+
+	/**
+	 * @brief Decompresses a block produced by `Compress`.
+	 * @param data Compressed block.
+	 * @return The original bytes, or a `BufferCorrupted` error if the block is malformed.
+	 */
+	STORMBYTE_PUBLIC ExpectedData<BufferCorrupted> 							Decompress(const ConstByteSpan& data);
+
+	/**
+	 * @brief Decompresses the unread data of a buffer holding a block produced by `Compress`.
+	 * @param buffer Buffer to decompress; `Shared` buffers must not be written meanwhile.
+	 * @return Buffer with the original bytes, or a `BufferCorrupted` error if the block is malformed.
+	 */
+	STORMBYTE_PUBLIC Expected<Simple, BufferCorrupted> 						Decompress(const Simple& buffer);
+
+	/**
+	 * @brief Creates a pipe compressing its input into frames.
+	 *
+	 * Input is cut into blocks of `BlockSize` bytes (the last one may be shorter), each written as a varint
+	 * with its compressed length followed by the block. The output is closed with `Status::ReadOnly` once
+	 * the input closes, or set to `Status::Error` if the input ends in error.
+	 *
+	 * @return The pipe function.
+	 */
+	STORMBYTE_PUBLIC PipeFunction 											Compressor();
+
+	/**
+	 * @brief Creates a pipe decompressing the frames written by `Compressor`.
+	 *
+	 * Each frame is forwarded as soon as it is decompressed. The output is set to `Status::Error` if a frame
+	 * is truncated or malformed, and closed with `Status::ReadOnly` otherwise.
+	 *
+	 * @return The pipe function.
+	 */
+	STORMBYTE_PUBLIC PipeFunction 											Decompressor();
+}
\ No newline at end of file
@@ -1,10 +1,42 @@
 #include <StormByte/buffers/consumer.hxx>
 
+#include <utility>
+
 using namespace StormByte::Buffers;
 
 // Constructor that initializes the consumer with a shared buffer
 Consumer::Consumer(std::shared_ptr<Shared> shared) noexcept
-    : m_shared(std::move(shared)) {}
+    : m_shared(std::move(shared)) {
+    if (m_shared) {
+        m_shared->m_consumers.fetch_add(1);
+    }
+}
+
+// Copies share the buffer and count as one more consumer of it
+Consumer::Consumer(const Consumer& other) noexcept
+    : Consumer(other.m_shared) {}
+
+Consumer::~Consumer() noexcept {
+    if (m_shared) {
+        m_shared->m_consumers.fetch_sub(1);
+    }
+}
+
+Consumer& Consumer::operator=(const Consumer& other) noexcept {
+    if (this != &other) {
+        Consumer copy(other);
+        std::swap(m_shared, copy.m_shared);
+    }
+    return *this;
+}
+
+Consumer& Consumer::operator=(Consumer&& other) noexcept {
+    if (this != &other) {
+        Consumer moved(std::move(other));
+        std::swap(m_shared, moved.m_shared);
+    }
+    return *this;
+}
 
 size_t Consumer::AvailableBytes() const noexcept {
 	return m_shared->AvailableBytes();
@@ -16,7 +48,7 @@ Data Consumer::Data() const noexcept {
 }
 
 // Discards data from the buffer
-void Consumer::Discard(const std::size_t& length, const Read::Position& mode) noexcept {
+void Consumer::Discard(const std::size_t& length, const Read::Position& mode) {
     m_shared->Discard(length, mode);
 }
 
@@ -35,12 +67,37 @@ ExpectedData<BufferOverflow> Consumer::Extract(const size_t& length) {
     return m_shared->Extract(length);
 }
 
+// Extracts a specific size of data, waiting for it until a deadline
+ExpectedData<BufferOverflow> Consumer::Extract(const size_t& length, const std::chrono::steady_clock::time_point& deadline) {
+    return m_shared->Extract(length, deadline);
+}
+
+// Extracts a specific size of data, waiting for it a limited time
+ExpectedData<BufferOverflow> Consumer::Extract(const size_t& length, const std::chrono::steady_clock::duration& timeout) {
+    return m_shared->Extract(length, timeout);
+}
+
+// Extracts a specific size of data without blocking the thread
+Async::Awaitable<ExpectedData<BufferOverflow>> Consumer::ExtractAsync(const size_t& length) {
+    return Async::Awaitable<ExpectedData<BufferOverflow>>(m_shared, Async::ReadOperation(m_shared, length, [shared = m_shared, length] {
+        return shared->TryExtract(length);
+    }));
+}
+
 // Extracts a specific size of data and moves it directly into the provided buffer
 Read::Status Consumer::ExtractInto(const size_t& length, Shared& output) noexcept {
     return m_shared->ExtractInto(length, output);
 }
 
 // Checks if the shared buffer has enough data starting from the current read position
+std::optional<std::size_t> Consumer::Find(const Byte& value) const {
+    return m_shared->Find(value);
+}
+
+std::optional<std::size_t> Consumer::Find(const ConstByteSpan& pattern) const {
+    return m_shared->Find(pattern);
+}
+
 bool Consumer::HasEnoughData(const std::size_t& length) const {
     return m_shared->HasEnoughData(length);
 }
@@ -50,6 +107,18 @@ std::string Consumer::HexData(const std::size_t& column_size) const {
     return m_shared->HexData(column_size);
 }
 
+std::string Consumer::HexData(const std::size_t& offset, const std::size_t& length, const std::size_t& column_size) const {
+    return m_shared->HexData(offset, length, column_size);
+}
+
+void Consumer::HexData(std::ostream& output, const std::size_t& offset, const std::size_t& length, const std::size_t& column_size) const {
+    m_shared->HexData(output, offset, length, column_size);
+}
+
+Write::Status Consumer::HexData(Producer& output, const std::size_t& offset, const std::size_t& length, const std::size_t& column_size) const {
+    return m_shared->HexData(output, offset, length, column_size);
+}
+
 // Checks if the buffer is at the end of the file/data
 bool Consumer::IsEoF() const noexcept {
     return m_shared->IsEoF();
@@ -65,6 +134,11 @@ ExpectedByte<BufferOverflow> Consumer::Peek() const {
     return m_shared->Peek();
 }
 
+// Retrieves a guarded view of the next bytes without advancing the read position
+StormByte::Expected<SharedView, BufferOverflow> Consumer::PeekView(const std::size_t& length) const {
+    return m_shared->PeekView(length);
+}
+
 // Retrieves the read position
 std::size_t Consumer::Position() const noexcept {
     return m_shared->Position();
@@ -75,6 +149,44 @@ ExpectedData<BufferOverflow> Consumer::Read(const size_t& length) const {
     return m_shared->Read(length);
 }
 
+// Reads a specific size of data, waiting for it until a deadline
+ExpectedData<BufferOverflow> Consumer::Read(const size_t& length, const std::chrono::steady_clock::time_point& deadline) const {
+    return m_shared->Read(length, deadline);
+}
+
+// Reads a specific size of data, waiting for it a limited time
+ExpectedData<BufferOverflow> Consumer::Read(const size_t& length, const std::chrono::steady_clock::duration& timeout) const {
+    return m_shared->Read(length, timeout);
+}
+
+// Reads a specific size of data without blocking the thread
+Async::Awaitable<ExpectedData<BufferOverflow>> Consumer::ReadAsync(const size_t& length) const {
+    return Async::Awaitable<ExpectedData<BufferOverflow>>(m_shared, Async::ReadOperation(m_shared, length, [shared = m_shared, length] {
+        return shared->TryRead(length);
+    }));
+}
+
+// Retrieves a guarded view of the next bytes and advances the read position
+StormByte::Expected<std::string, BufferOverflow> Consumer::ReadLine() const {
+    return m_shared->ReadLine();
+}
+
+ExpectedData<BufferOverflow> Consumer::ReadUntil(const Byte& delimiter) const {
+    return m_shared->ReadUntil(delimiter);
+}
+
+ExpectedData<BufferOverflow> Consumer::ReadUntil(const ConstByteSpan& delimiter) const {
+    return m_shared->ReadUntil(delimiter);
+}
+
+ExpectedData<BufferOverflow> Consumer::ReadUntil(const std::string& delimiter) const {
+    return m_shared->ReadUntil(delimiter);
+}
+
+StormByte::Expected<SharedView, BufferOverflow> Consumer::ReadView(const std::size_t& length) const {
+    return m_shared->ReadView(length);
+}
+
 // Moves the read pointer within the shared buffer based on the specified position and mode
 void Consumer::Seek(const std::ptrdiff_t& position, const Read::Position& mode) const {
     m_shared->Seek(position, mode);
@@ -85,8 +197,33 @@ std::size_t Consumer::Size() const noexcept {
     return m_shared->Size();
 }
 
+// Retrieves a snapshot of the buffer counters
+Shared::Statistics Consumer::Stats() const noexcept {
+    return m_shared->Stats();
+}
+
 // Gets the buffer status
 enum Status Consumer::Status() const noexcept {
     return m_shared->Status();
 }
 
+// Locks the buffer for a sequence of reads taking the lock only once
+SharedTransaction Consumer::Transaction() {
+    return m_shared->Transaction();
+}
+
+// Extracts a specific size of data only if it is already available
+ExpectedData<BufferOverflow> Consumer::TryExtract(const size_t& length) {
+    return m_shared->TryExtract(length);
+}
+
+// Reads a specific size of data only if it is already available
+ExpectedData<BufferOverflow> Consumer::TryRead(const size_t& length) const {
+    return m_shared->TryRead(length);
+}
+
+// Writes the available data to a file descriptor and removes it from the shared buffer
+StormByte::Expected<std::size_t, BufferIOError> Consumer::WriteTo(const int& fd) {
+    return m_shared->WriteTo(fd);
+}
+
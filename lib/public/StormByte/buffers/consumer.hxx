@@ -1,5 +1,6 @@
 #pragma once
 
+#include <StormByte/buffers/async.hxx>
 #include <StormByte/buffers/shared.hxx>
 #include <memory>
 
@@ -40,7 +41,7 @@ namespace StormByte::Buffers {
 			 * 
 			 * The `Consumer` class cannot be copied to ensure data integrity and prevent unintended sharing of the buffer.
 			 */
-			Consumer(const Consumer& other) 							= default;
+			Consumer(const Consumer& other) noexcept;
 
 			/**
 			 * @brief Default move constructor
@@ -53,22 +54,23 @@ namespace StormByte::Buffers {
 			 * @brief Destructor
 			 * 
 			 * Cleans up the `Consumer` instance. The destructor ensures that any resources held by the `Consumer` are properly released.
+			 * Once the last consumer of a broadcasting buffer is gone, its own read position no longer holds the stream back.
 			 */
-			~Consumer() noexcept = default;
+			~Consumer() noexcept;
 
 			/**
 			 * @brief Deleted copy assignment operator
 			 * 
 			 * The `Consumer` class cannot be copied to ensure data integrity and prevent unintended sharing of the buffer.
 			 */
-			Consumer& operator=(const Consumer& other) 					= default;
+			Consumer& operator=(const Consumer& other) noexcept;
 
 			/**
 			 * @brief Default move assignment operator
 			 * 
 			 * Allows moving a `Consumer` instance. The moved-from instance is left in a valid but unspecified state.
 			 */
-			Consumer& operator=(Consumer&& other) noexcept 				= default;
+			Consumer& operator=(Consumer&& other) noexcept;
 
 			/**
 			 * @brief Retrieves the number of bytes available for reading.
@@ -87,7 +89,7 @@ namespace StormByte::Buffers {
 			 * @param length The number of bytes to discard.
 			 * @param mode The read position mode.
 			 */
-			void 														Discard(const std::size_t& length, const Read::Position& mode) noexcept;
+			void 														Discard(const std::size_t& length, const Read::Position& mode);
 
 			/**
 			 * @brief Checks if the read position is at the end.
@@ -108,6 +110,31 @@ namespace StormByte::Buffers {
 			 */
 			ExpectedData<BufferOverflow> 								Extract(const size_t& length);
 
+			/**
+			 * @brief Extracts a specific size of data, waiting for it until a deadline.
+			 * @param length The number of bytes to extract.
+			 * @param deadline Time to stop waiting at.
+			 * @return The extracted data, or a `BufferTimeout` error if it did not arrive in time.
+			 * @see Shared::Extract(const size_t&, const std::chrono::steady_clock::time_point&)
+			 */
+			ExpectedData<BufferOverflow> 								Extract(const size_t& length, const std::chrono::steady_clock::time_point& deadline);
+
+			/**
+			 * @brief Extracts a specific size of data, waiting for it at most `timeout`.
+			 * @param length The number of bytes to extract.
+			 * @param timeout Longest time to wait.
+			 * @return The extracted data, or a `BufferTimeout` error if it did not arrive in time.
+			 */
+			ExpectedData<BufferOverflow> 								Extract(const size_t& length, const std::chrono::steady_clock::duration& timeout);
+
+			/**
+			 * @brief Extracts a specific size of data, suspending the awaiting coroutine instead of its thread.
+			 * @param length The number of bytes to extract.
+			 * @return Awaitable giving the extracted data, or a `BufferOverflow` error if the buffer ends first.
+			 * @see Async::Awaitable
+			 */
+			Async::Awaitable<ExpectedData<BufferOverflow>> 				ExtractAsync(const size_t& length);
+
 			/**
 			 * @brief Extracts a specific size of data and moves it directly into the provided buffer.
 			 * @param length The number of bytes to extract.
@@ -123,6 +150,20 @@ namespace StormByte::Buffers {
 			 */
 			bool 														HasEnoughData(const std::size_t& length) const;
 
+			/**
+			 * @brief Finds the first occurrence of a byte in the unread data, without waiting for it.
+			 * @param value The byte to find.
+			 * @return Offset of the byte from the read position, or `std::nullopt` if it is not stored yet.
+			 */
+			std::optional<std::size_t> 									Find(const Byte& value) const;
+
+			/**
+			 * @brief Finds the first occurrence of a byte sequence in the unread data, without waiting for it.
+			 * @param pattern The sequence to find.
+			 * @return Offset of the sequence from the read position, or `std::nullopt` if it is not stored yet.
+			 */
+			std::optional<std::size_t> 									Find(const ConstByteSpan& pattern) const;
+
 			/**
 			 * @brief Retrieves the stored value as a hexadecimal string.
 			 * @param column_size The number of bytes per column in the output.
@@ -130,6 +171,34 @@ namespace StormByte::Buffers {
 			 */
 			std::string 												HexData(const std::size_t& column_size = 16) const;
 
+			/**
+			 * @brief Retrieves a range of the stored value as a hexadecimal string.
+			 * @param offset First byte of the range, counted from the start of the stored data.
+			 * @param length Number of bytes of the range, clamped to the stored data.
+			 * @param column_size The number of bytes per column in the output.
+			 * @return The hexadecimal representation of the range.
+			 */
+			std::string 												HexData(const std::size_t& offset, const std::size_t& length, const std::size_t& column_size = 16) const;
+
+			/**
+			 * @brief Streams a range of the stored value as hexadecimal to an output stream.
+			 * @param output Stream receiving the dump.
+			 * @param offset First byte of the range, counted from the start of the stored data.
+			 * @param length Number of bytes of the range, clamped to the stored data.
+			 * @param column_size The number of bytes per column in the output.
+			 */
+			void 														HexData(std::ostream& output, const std::size_t& offset = 0, const std::size_t& length = std::numeric_limits<std::size_t>::max(), const std::size_t& column_size = 16) const;
+
+			/**
+			 * @brief Streams a range of the stored value as hexadecimal to a producer.
+			 * @param output Producer receiving the dump.
+			 * @param offset First byte of the range, counted from the start of the stored data.
+			 * @param length Number of bytes of the range, clamped to the stored data.
+			 * @param column_size The number of bytes per column in the output.
+			 * @return `Write::Status::Success`, or the first failed write status.
+			 */
+			Write::Status 												HexData(Producer& output, const std::size_t& offset = 0, const std::size_t& length = std::numeric_limits<std::size_t>::max(), const std::size_t& column_size = 16) const;
+
 			/**
 			 * @brief Checks if the buffer is at the end of the file/data.
 			 * @return True if the buffer is at the end, false otherwise.
@@ -148,6 +217,24 @@ namespace StormByte::Buffers {
 			 */
 			ExpectedByte<BufferOverflow> 								Peek() const;
 
+			/**
+			 * @brief Retrieves a guarded view of the next bytes without advancing the read position.
+			 * @param length The number of bytes to view.
+			 * @return A view pinning the bytes, see `SharedView` for its lifetime rules.
+			 */
+			Expected<SharedView, BufferOverflow> 						PeekView(const std::size_t& length) const;
+
+			/**
+			 * @brief Decodes a numeric value at the read position without advancing it, waiting for its bytes.
+			 * @tparam T Arithmetic or enumeration type of 1, 2, 4 or 8 bytes.
+			 * @param endian Byte order of the stored value.
+			 * @return The decoded value, or a `BufferOverflow` error if the buffer ends first.
+			 */
+			template<Binary::Numeric T>
+			Expected<T, BufferOverflow> 								PeekAs(const std::endian& endian = std::endian::native) const {
+				return m_shared->PeekAs<T>(endian);
+			}
+
 			/**
 			 * @brief Retrieves the read position.
 			 * @return The current read position.
@@ -161,6 +248,86 @@ namespace StormByte::Buffers {
 			 */
 			ExpectedData<BufferOverflow> 								Read(const size_t& length) const;
 
+			/**
+			 * @brief Reads a specific size of data, waiting for it until a deadline.
+			 * @param length The number of bytes to read.
+			 * @param deadline Time to stop waiting at.
+			 * @return The read data, or a `BufferTimeout` error if it did not arrive in time.
+			 * @see Shared::Read(const size_t&, const std::chrono::steady_clock::time_point&)
+			 */
+			ExpectedData<BufferOverflow> 								Read(const size_t& length, const std::chrono::steady_clock::time_point& deadline) const;
+
+			/**
+			 * @brief Reads a specific size of data, waiting for it at most `timeout`.
+			 * @param length The number of bytes to read.
+			 * @param timeout Longest time to wait.
+			 * @return The read data, or a `BufferTimeout` error if it did not arrive in time.
+			 */
+			ExpectedData<BufferOverflow> 								Read(const size_t& length, const std::chrono::steady_clock::duration& timeout) const;
+
+			/**
+			 * @brief Reads a specific size of data, suspending the awaiting coroutine instead of its thread.
+			 * @param length The number of bytes to read.
+			 * @return Awaitable giving the read data, or a `BufferOverflow` error if the buffer ends first.
+			 * @see Async::Awaitable
+			 */
+			Async::Awaitable<ExpectedData<BufferOverflow>> 				ReadAsync(const size_t& length) const;
+
+			/**
+			 * @brief Reads a line, waiting for its terminator to be written.
+			 * @return The line without its `\n` or `\r\n` terminator, or a `BufferOverflow` error if the buffer ends first.
+			 */
+			Expected<std::string, BufferOverflow> 						ReadLine() const;
+
+			/**
+			 * @brief Reads the data before a delimiter, waiting for the delimiter to be written.
+			 * @param delimiter The byte ending the data, consumed but not returned.
+			 * @return The data, or a `BufferOverflow` error if the buffer ends first.
+			 */
+			ExpectedData<BufferOverflow> 								ReadUntil(const Byte& delimiter) const;
+
+			/**
+			 * @brief Reads the data before a delimiter sequence, waiting for the delimiter to be written.
+			 * @param delimiter The sequence ending the data, consumed but not returned.
+			 * @return The data, or a `BufferOverflow` error if the buffer ends first.
+			 */
+			ExpectedData<BufferOverflow> 								ReadUntil(const ConstByteSpan& delimiter) const;
+
+			/**
+			 * @brief Reads the data before a delimiter string, waiting for the delimiter to be written.
+			 * @param delimiter The string ending the data, consumed but not returned.
+			 * @return The data, or a `BufferOverflow` error if the buffer ends first.
+			 */
+			ExpectedData<BufferOverflow> 								ReadUntil(const std::string& delimiter) const;
+
+			/**
+			 * @brief Decodes a numeric value at the read position and advances past it, waiting for its bytes.
+			 * @tparam T Arithmetic or enumeration type of 1, 2, 4 or 8 bytes.
+			 * @param endian Byte order of the stored value.
+			 * @return The decoded value, or a `BufferOverflow` error if the buffer ends first.
+			 */
+			template<Binary::Numeric T>
+			Expected<T, BufferOverflow> 								ReadAs(const std::endian& endian = std::endian::native) const {
+				return m_shared->ReadAs<T>(endian);
+			}
+
+			/**
+			 * @brief Decodes a LEB128 varint at the read position, waiting for its bytes.
+			 * @tparam T Integral type to decode.
+			 * @return The decoded value, or a `BufferOverflow` error if the varint is truncated, malformed or out of range.
+			 */
+			template<std::integral T>
+			Expected<T, BufferOverflow> 								ReadVarint() const {
+				return m_shared->ReadVarint<T>();
+			}
+
+			/**
+			 * @brief Retrieves a guarded view of the next bytes and advances the read position.
+			 * @param length The number of bytes to view.
+			 * @return A view pinning the bytes, see `SharedView` for its lifetime rules.
+			 */
+			Expected<SharedView, BufferOverflow> 						ReadView(const std::size_t& length) const;
+
 			/**
 			 * @brief Moves the read pointer within the shared buffer based on the specified position and mode.
 			 * @param position The position to move to.
@@ -174,12 +341,48 @@ namespace StormByte::Buffers {
 			 */
 			std::size_t 												Size() const noexcept;
 
+			/**
+			 * @brief Retrieves a snapshot of the buffer counters.
+			 * @return Current statistics.
+			 * @see Shared::Stats
+			 */
+			Shared::Statistics 											Stats() const noexcept;
+
 			/**
 			 * @brief Gets the buffer status.
 			 * @return The current status of the buffer.
 			 */
 			enum Status 												Status() const noexcept;
 
+			/**
+			 * @brief Locks the buffer for a sequence of reads taking the lock only once.
+			 * @return Transaction giving access to the locked buffer.
+			 * @see Shared::Transaction
+			 */
+			SharedTransaction 											Transaction();
+
+			/**
+			 * @brief Extracts a specific size of data only if it is already available.
+			 * @param length The number of bytes to extract.
+			 * @return The extracted data, or a `BufferTimeout` error if it is not there yet.
+			 */
+			ExpectedData<BufferOverflow> 								TryExtract(const size_t& length);
+
+			/**
+			 * @brief Reads a specific size of data only if it is already available.
+			 * @param length The number of bytes to read.
+			 * @return The read data, or a `BufferTimeout` error if it is not there yet.
+			 */
+			ExpectedData<BufferOverflow> 								TryRead(const size_t& length) const;
+
+			/**
+			 * @brief Writes the available data to a file descriptor and removes it from the shared buffer.
+			 * @param fd File descriptor to write to.
+			 * @return Number of bytes written, or a `BufferIOError` if nothing could be written.
+			 * @see Shared::WriteTo
+			 */
+			Expected<std::size_t, BufferIOError> 						WriteTo(const int& fd);
+
 		private:
 			std::shared_ptr<Shared> m_shared; 							///< The shared buffer instance.
 
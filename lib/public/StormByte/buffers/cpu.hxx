@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * @file cpu.hxx
+ * @brief Internal: instruction set detection shared by the vectorized codecs.
+ *
+ * Only included by the library sources and not installed. On x86 it defines `STORMBYTE_BUFFERS_X86`,
+ * includes the intrinsics and provides the `SSSE3_TARGET` and `SSE42_TARGET` attributes, which let a
+ * single function use those instructions without building the whole library for them. Callers must
+ * check @see CPU::HasSSSE3 or @see CPU::HasSSE42 before calling such a function.
+ */
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define STORMBYTE_BUFFERS_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define SSSE3_TARGET
+#define SSE42_TARGET
+#else
+#define SSSE3_TARGET __attribute__((target("ssse3")))
+#define SSE42_TARGET __attribute__((target("sse4.2")))
+#endif
+#endif
+
+namespace StormByte::Buffers::CPU {
+	#ifdef STORMBYTE_BUFFERS_X86
+	#ifdef _MSC_VER
+	/**
+	 * @brief Checks a feature bit reported by `cpuid` leaf 1
+	 * @param bit Bit of the `ecx` register.
+	 * @return True if the running processor has the feature.
+	 */
+	inline bool HasFeature(const int& bit) noexcept {
+		int info[4];
+		__cpuid(info, 1);
+		return (info[2] & (1 << bit)) != 0;
+	}
+	#endif
+
+	/**
+	 * @brief Checks for SSSE3, detected once
+	 * @return True if the running processor has it.
+	 */
+	inline bool HasSSSE3() noexcept {
+		#ifdef _MSC_VER
+		static const bool supported = HasFeature(9);
+		#else
+		static const bool supported = (__builtin_cpu_init(), __builtin_cpu_supports("ssse3"));
+		#endif
+		return supported;
+	}
+
+	/**
+	 * @brief Checks for SSE4.2, detected once
+	 * @return True if the running processor has it.
+	 */
+	inline bool HasSSE42() noexcept {
+		#ifdef _MSC_VER
+		static const bool supported = HasFeature(20);
+		#else
+		static const bool supported = (__builtin_cpu_init(), __builtin_cpu_supports("sse4.2"));
+		#endif
+		return supported;
+	}
+	#endif
+}
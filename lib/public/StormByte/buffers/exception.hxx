@@ -75,4 +75,57 @@ namespace StormByte::Buffers {
              */
             using StormByte::Buffers::Exception::Exception;
     };
+
+    /**
+     * @class BufferIOError
+     * @brief Exception class for buffer input/output errors.
+     *
+     * The `BufferIOError` exception is returned when moving data between a buffer and a
+     * file descriptor fails at the operating system level. The message includes the
+     * system error description.
+     *
+     * Inherits all functionality from the `StormByte::Buffers::Exception` class.
+     */
+    class STORMBYTE_PUBLIC BufferIOError: public StormByte::Buffers::Exception {
+        public:
+            /**
+             * @brief Constructor
+             * @param reason A description of the exception as a `std::string`.
+             */
+            using StormByte::Buffers::Exception::Exception;
+    };
+
+    /**
+     * @class BufferCorrupted
+     * @brief Exception class for malformed encoded data.
+     *
+     * The `BufferCorrupted` exception is returned when decoding data (for example decompressing
+     * a block) finds it truncated or inconsistent with its own format.
+     *
+     * Inherits all functionality from the `StormByte::Buffers::Exception` class.
+     */
+    class STORMBYTE_PUBLIC BufferCorrupted: public StormByte::Buffers::Exception {
+        public:
+            /**
+             * @brief Constructor
+             * @param reason A description of the exception as a `std::string`.
+             */
+            using StormByte::Buffers::Exception::Exception;
+    };
+
+    /**
+     * @class BufferTimeout
+     * @brief Exception class for reads that ran out of time waiting for data.
+     *
+     * Derives from `BufferOverflow` so timed reads keep the error type of their blocking counterparts;
+     * use `std::dynamic_pointer_cast<BufferTimeout>` on the error to tell a timeout from a closed buffer.
+     */
+    class STORMBYTE_PUBLIC BufferTimeout: public StormByte::Buffers::BufferOverflow {
+        public:
+            /**
+             * @brief Constructor
+             * @param reason A description of the exception as a `std::string`.
+             */
+            using StormByte::Buffers::BufferOverflow::BufferOverflow;
+    };
 }
\ No newline at end of file
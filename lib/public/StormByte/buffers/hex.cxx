@@ -0,0 +1,196 @@
+#include <StormByte/buffers/consumer.hxx>
+#include <StormByte/buffers/cpu.hxx>
+#include <StormByte/buffers/hex.hxx>
+#include <StormByte/buffers/hexdigits.hxx>
+#include <StormByte/buffers/producer.hxx>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+using namespace StormByte::Buffers;
+
+namespace {
+	constexpr std::uint8_t Invalid = 0xFF;
+
+	// Value of every digit in either case, `Invalid` for the rest
+	constexpr std::array<std::uint8_t, 256> Values = [] {
+		std::array<std::uint8_t, 256> values {};
+		values.fill(Invalid);
+		for (std::uint8_t value = 0; value < 16; value++) {
+			values[static_cast<std::uint8_t>(HexDigits::Digits[value])] = value;
+			values[static_cast<std::uint8_t>("0123456789abcdef"[value])] = value;
+		}
+		return values;
+	}();
+
+	void EncodeScalar(const std::uint8_t* data, const std::size_t& length, char* output) noexcept {
+		for (std::size_t index = 0; index < length; index++) {
+			std::memcpy(output + 2 * index, &HexDigits::Pairs[2 * data[index]], 2);
+		}
+	}
+
+	// Decodes digit pairs, returns how many digits were decoded before the first invalid pair
+	std::size_t DecodeScalar(const std::uint8_t* text, const std::size_t& length, std::uint8_t* output) noexcept {
+		std::size_t index = 0;
+		for (; index + 2 <= length; index += 2) {
+			const std::uint8_t high = Values[text[index]], low = Values[text[index + 1]];
+			if (((high | low) & 0xF0) != 0) {
+				break;
+			}
+			*output++ = static_cast<std::uint8_t>((high << 4) | low);
+		}
+		return index;
+	}
+
+	#ifdef STORMBYTE_BUFFERS_X86
+	// Encodes 16 bytes into 32 digits per step, returns the number of bytes encoded
+	SSSE3_TARGET std::size_t EncodeSSSE3(const std::uint8_t* data, const std::size_t& length, char* output) noexcept {
+		std::size_t index = 0;
+		for (; index + 16 <= length; index += 16) {
+			__m128i first, second;
+			HexDigits::Encode16(data + index, first, second);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 2 * index), first);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 2 * index + 16), second);
+		}
+		return index;
+	}
+
+	// Converts 16 digits to their values, clearing `valid` if any of them is not a digit
+	SSSE3_TARGET inline __m128i DigitValues(const __m128i& characters, bool& valid) noexcept {
+		// Unsigned range checks: c - '0' <= 9 for digits, (c | 0x20) - 'a' <= 5 for letters
+		const __m128i digit = _mm_sub_epi8(characters, _mm_set1_epi8('0'));
+		const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+		const __m128i letter = _mm_sub_epi8(_mm_or_si128(characters, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+		const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+		valid = valid && _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) == 0xFFFF;
+		return _mm_or_si128(
+			_mm_and_si128(is_digit, digit),
+			_mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10)))
+		);
+	}
+
+	// Decodes 32 digits into 16 bytes per step, stopping before the first block with an invalid digit
+	SSSE3_TARGET std::size_t DecodeSSSE3(const std::uint8_t* text, const std::size_t& length, std::uint8_t* output) noexcept {
+		std::size_t index = 0;
+		for (; index + 32 <= length; index += 32, output += 16) {
+			bool valid = true;
+			const __m128i first = DigitValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + index)), valid);
+			const __m128i second = DigitValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + index + 16)), valid);
+			if (!valid) {
+				break;
+			}
+			// high * 16 + low for every pair of digits
+			const __m128i weights = _mm_set1_epi16(0x0110);
+			const __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output), bytes);
+		}
+		return index;
+	}
+	#endif
+
+	std::size_t EncodeInto(const ConstByteSpan& data, char* output) noexcept {
+		const auto* bytes = reinterpret_cast<const std::uint8_t*>(data.data());
+		std::size_t encoded = 0;
+		#ifdef STORMBYTE_BUFFERS_X86
+		if (CPU::HasSSSE3()) {
+			encoded = EncodeSSSE3(bytes, data.size(), output);
+		}
+		#endif
+		EncodeScalar(bytes + encoded, data.size() - encoded, output + 2 * encoded);
+		return 2 * data.size();
+	}
+
+	Data EncodeData(const ConstByteSpan& data) {
+		Data text(2 * data.size());
+		EncodeInto(data, reinterpret_cast<char*>(text.data()));
+		return text;
+	}
+
+	ExpectedData<BufferCorrupted> DecodeText(const ConstByteSpan& text) {
+		const auto* characters = reinterpret_cast<const std::uint8_t*>(text.data());
+		if (text.size() % 2 != 0) {
+			return StormByte::Unexpected<BufferCorrupted>("Hex text of {} digits has a dangling digit", text.size());
+		}
+
+		Data decoded(text.size() / 2);
+		auto* output = reinterpret_cast<std::uint8_t*>(decoded.data());
+		std::size_t index = 0;
+		#ifdef STORMBYTE_BUFFERS_X86
+		if (CPU::HasSSSE3()) {
+			index = DecodeSSSE3(characters, text.size(), output);
+		}
+		#endif
+		index += DecodeScalar(characters + index, text.size() - index, output + index / 2);
+		if (index < text.size()) {
+			const std::size_t offset = Values[characters[index]] == Invalid ? index : index + 1;
+			return StormByte::Unexpected<BufferCorrupted>("Invalid hex digit at offset {}", offset);
+		}
+		return decoded;
+	}
+}
+
+std::size_t Hex::Encode(const ConstByteSpan& data, char* output) noexcept {
+	return EncodeInto(data, output);
+}
+
+std::string Hex::Encode(const ConstByteSpan& data) {
+	std::string text(2 * data.size(), '\0');
+	EncodeInto(data, text.data());
+	return text;
+}
+
+Write::Status Hex::Encode(const ConstByteSpan& data, Simple& output) {
+	return output.Write(EncodeData(data));
+}
+
+ExpectedData<BufferCorrupted> Hex::Decode(const ConstByteSpan& text) {
+	return DecodeText(text);
+}
+
+ExpectedData<BufferCorrupted> Hex::Decode(const std::string& text) {
+	return DecodeText(ConstByteSpan(reinterpret_cast<const Byte*>(text.data()), text.size()));
+}
+
+StormByte::Expected<Simple, BufferCorrupted> Hex::Decode(const Simple& buffer) {
+	auto decoded = DecodeText(buffer.Span().subspan(buffer.Position()));
+	if (!decoded) {
+		return StormByte::Unexpected(decoded.error());
+	}
+	return Simple(std::move(decoded.value()));
+}
+
+PipeFunction Hex::Encoder() {
+	return [](Consumer input, Producer output) {
+		while (!input.IsEoF()) {
+			// Encode whatever arrived, waiting for at least one byte
+			auto chunk = input.Extract(std::max<std::size_t>(input.AvailableBytes(), 1));
+			if (!chunk) {
+				break;
+			}
+			output.Write(EncodeData(*chunk));
+		}
+		output << (input.Status() == Status::Error ? Status::Error : Status::ReadOnly);
+	};
+}
+
+PipeFunction Hex::Decoder() {
+	return [](Consumer input, Producer output) {
+		while (input.PeekView(2)) {
+			auto chunk = input.Extract(input.AvailableBytes() / 2 * 2);
+			if (!chunk) {
+				break;
+			}
+			auto decoded = DecodeText(*chunk);
+			if (!decoded) {
+				output << Status::Error;
+				return;
+			}
+			output.Write(std::move(*decoded));
+		}
+		// A closed input must not leave half a byte behind
+		const bool valid = input.Status() != Status::Error && input.AvailableBytes() == 0;
+		output << (valid ? Status::ReadOnly : Status::Error);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <StormByte/buffers/exception.hxx>
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+#include <string>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers::Hex {
+	/**
+	 * @brief Encodes bytes as two uppercase hex digits each into a caller provided buffer.
+	 *
+	 * Uses SSSE3 when the processor supports it and a table driven encoder otherwise.
+	 *
+	 * @param data Bytes to encode.
+	 * @param output Destination, must hold at least `2 * data.size()` characters.
+	 * @return Number of characters written.
+	 */
+	STORMBYTE_PUBLIC std::size_t 											Encode(const ConstByteSpan& data, char* output) noexcept;
+
+	/**
+	 * @brief Encodes bytes as two uppercase hex digits each.
+	 * @param data Bytes to encode.
+	 * @return The encoded text.
+	 */
+	STORMBYTE_PUBLIC std::string 											Encode(const ConstByteSpan& data);
+
+	/**
+	 * @brief Encodes bytes as two uppercase hex digits each and appends the text to a buffer.
+	 * @param data Bytes to encode.
+	 * @param output Buffer receiving the encoded text.
+	 * @return The status of the write.
+	 */
+	STORMBYTE_PUBLIC Write::Status 											Encode(const ConstByteSpan& data, Simple& output);
+
+	/**
+	 * @brief Decodes hex text.
+	 *
+	 * Digits may be upper or lower case. Separators, whitespace and an odd number of digits are rejected.
+	 *
+	 * @param text Encoded text.
+	 * @return The decoded bytes, or a `BufferCorrupted` error naming the offending offset.
+	 */
+	STORMBYTE_PUBLIC ExpectedData<BufferCorrupted> 							Decode(const ConstByteSpan& text);
+
+	/**
+	 * @brief Decodes hex text.
+	 * @param text Encoded text.
+	 * @return The decoded bytes, or a `BufferCorrupted` error naming the offending offset.
+	 * @see Decode(const ConstByteSpan&)
+	 */
+	STORMBYTE_PUBLIC ExpectedData<BufferCorrupted> 							Decode(const std::string& text);
+
+	/**
+	 * @brief Decodes the unread text of a buffer.
+	 * @param buffer Buffer holding the encoded text; `Shared` buffers must not be written meanwhile.
+	 * @return Buffer with the decoded bytes, or a `BufferCorrupted` error naming the offending offset.
+	 */
+	STORMBYTE_PUBLIC Expected<Simple, BufferCorrupted> 						Decode(const Simple& buffer);
+
+	/**
+	 * @brief Creates a pipe encoding its input to hex.
+	 *
+	 * Data is encoded as soon as it arrives. The output is closed with `Status::ReadOnly`, or set to
+	 * `Status::Error` if the input ends in error.
+	 *
+	 * @return The pipe function.
+	 */
+	STORMBYTE_PUBLIC PipeFunction 											Encoder();
+
+	/**
+	 * @brief Creates a pipe decoding hex text.
+	 *
+	 * Digit pairs are decoded as soon as they arrive. The output is set to `Status::Error` on invalid text
+	 * or a dangling digit, and closed with `Status::ReadOnly` otherwise.
+	 *
+	 * @return The pipe function.
+	 */
+	STORMBYTE_PUBLIC PipeFunction 											Decoder();
+}
\ No newline at end of file
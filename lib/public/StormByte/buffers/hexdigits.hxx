@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * @file hexdigits.hxx
+ * @brief Internal: hex digit tables and the SSSE3 digit step shared by the hex codec and the hex dump.
+ *
+ * Only included by the library sources and not installed.
+ */
+
+#include <StormByte/buffers/cpu.hxx>
+
+#include <array>
+#include <cstdint>
+
+namespace StormByte::Buffers::HexDigits {
+	/**
+	 * @brief Upper case digits by value, the first 16 bytes load into a single register.
+	 */
+	inline constexpr char Digits[] = "0123456789ABCDEF";
+
+	/**
+	 * @brief Two digits for every byte value, the high nibble first.
+	 */
+	inline constexpr std::array<char, 512> Pairs = [] {
+		std::array<char, 512> pairs {};
+		for (std::size_t value = 0; value < 256; value++) {
+			pairs[2 * value] = Digits[value >> 4];
+			pairs[2 * value + 1] = Digits[value & 0x0F];
+		}
+		return pairs;
+	}();
+
+	#ifdef STORMBYTE_BUFFERS_X86
+	/**
+	 * @brief Converts 16 bytes to their 32 digits
+	 * @param data Bytes to convert.
+	 * @param first Digit pairs of bytes 0-7.
+	 * @param second Digit pairs of bytes 8-15.
+	 */
+	SSSE3_TARGET inline void Encode16(const std::uint8_t* data, __m128i& first, __m128i& second) noexcept {
+		const __m128i digits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Digits));
+		const __m128i nibble = _mm_set1_epi8(0x0F);
+		const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+		const __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+		const __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, nibble));
+		first = _mm_unpacklo_epi8(high, low);
+		second = _mm_unpackhi_epi8(high, low);
+	}
+	#endif
+}
@@ -0,0 +1,197 @@
+#include <StormByte/buffers/cpu.hxx>
+#include <StormByte/buffers/hexdigits.hxx>
+#include <StormByte/buffers/hexdump.hxx>
+#include <StormByte/buffers/producer.hxx>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+using namespace StormByte::Buffers;
+
+namespace {
+	// Printable ASCII only, so the output does not depend on the current locale
+	constexpr char Printable(const std::uint8_t& value) noexcept {
+		return value >= 0x20 && value < 0x7F ? static_cast<char>(value) : '.';
+	}
+
+	std::size_t LineSize(const std::size_t& bytes, const std::size_t& column_size) noexcept {
+		return 3 * std::max(bytes, column_size) + 2 + bytes;
+	}
+
+	void EncodeHexScalar(const std::uint8_t* data, const std::size_t& length, char* output) noexcept {
+		for (std::size_t index = 0; index < length; index++) {
+			std::memcpy(output, &HexDigits::Pairs[2 * data[index]], 2);
+			output[2] = ' ';
+			output += 3;
+		}
+	}
+
+	void EncodeCharsScalar(const std::uint8_t* data, const std::size_t& length, char* output) noexcept {
+		for (std::size_t index = 0; index < length; index++) {
+			output[index] = Printable(data[index]);
+		}
+	}
+
+	#ifdef STORMBYTE_BUFFERS_X86
+	// Shuffle masks spreading the 32 interleaved digits of 16 bytes over 48 "XX " characters:
+	// `part` selects the 16 output characters, `half` the register holding digits of bytes 0-7 or 8-15
+	constexpr std::array<std::int8_t, 16> SpreadMask(const std::size_t& part, const std::size_t& half) {
+		std::array<std::int8_t, 16> mask {};
+		for (std::size_t index = 0; index < 16; index++) {
+			const std::size_t character = part * 16 + index, byte = character / 3, digit = character % 3;
+			mask[index] = digit == 2 || byte / 8 != half ? -1 : static_cast<std::int8_t>(2 * (byte % 8) + digit);
+		}
+		return mask;
+	}
+
+	constexpr std::array<std::int8_t, 16> SpaceMask(const std::size_t& part) {
+		std::array<std::int8_t, 16> mask {};
+		for (std::size_t index = 0; index < 16; index++) {
+			mask[index] = (part * 16 + index) % 3 == 2 ? ' ' : 0;
+		}
+		return mask;
+	}
+
+	constexpr std::array<std::array<std::int8_t, 16>, 6> SpreadMasks = {
+		SpreadMask(0, 0), SpreadMask(0, 1), SpreadMask(1, 0), SpreadMask(1, 1), SpreadMask(2, 0), SpreadMask(2, 1)
+	};
+	constexpr std::array<std::array<std::int8_t, 16>, 3> SpaceMasks = { SpaceMask(0), SpaceMask(1), SpaceMask(2) };
+
+	SSSE3_TARGET inline __m128i Load(const std::array<std::int8_t, 16>& values) noexcept {
+		return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data()));
+	}
+
+	// 16 bytes to 48 characters of "XX " groups
+	SSSE3_TARGET void EncodeHex16(const std::uint8_t* data, char* output) noexcept {
+		__m128i pairs[2];
+		HexDigits::Encode16(data, pairs[0], pairs[1]);
+
+		for (std::size_t part = 0; part < 3; part++) {
+			const __m128i characters = _mm_or_si128(
+				_mm_or_si128(
+					_mm_shuffle_epi8(pairs[0], Load(SpreadMasks[2 * part])),
+					_mm_shuffle_epi8(pairs[1], Load(SpreadMasks[2 * part + 1]))
+				),
+				Load(SpaceMasks[part])
+			);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16 * part), characters);
+		}
+	}
+
+	// 16 bytes to their printable characters, '.' for the rest
+	SSSE3_TARGET void EncodeChars16(const std::uint8_t* data, char* output) noexcept {
+		const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+		// Signed compares: bytes from 0x80 are negative and fail the first test
+		const __m128i printable = _mm_and_si128(
+			_mm_cmpgt_epi8(bytes, _mm_set1_epi8(0x1F)),
+			_mm_cmplt_epi8(bytes, _mm_set1_epi8(0x7F))
+		);
+		const __m128i characters = _mm_or_si128(
+			_mm_and_si128(printable, bytes),
+			_mm_andnot_si128(printable, _mm_set1_epi8('.'))
+		);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output), characters);
+	}
+
+	SSSE3_TARGET void EncodeSSSE3(const std::uint8_t* data, const std::size_t& length, char* hex, char* chars) noexcept {
+		std::size_t index = 0;
+		for (; index + 16 <= length; index += 16) {
+			EncodeHex16(data + index, hex + 3 * index);
+			EncodeChars16(data + index, chars + index);
+		}
+		EncodeHexScalar(data + index, length - index, hex + 3 * index);
+		EncodeCharsScalar(data + index, length - index, chars + index);
+	}
+	#endif
+
+	// Encodes one line of `length` bytes padded to `column_size` and returns its size
+	std::size_t EncodeLine(const std::uint8_t* data, const std::size_t& length, const std::size_t& column_size, char* output) noexcept {
+		const std::size_t hex_size = 3 * std::max(length, column_size);
+		char* chars = output + hex_size + 1;
+
+		#ifdef STORMBYTE_BUFFERS_X86
+		if (CPU::HasSSSE3()) {
+			EncodeSSSE3(data, length, output, chars);
+		}
+		else
+		#endif
+		{
+			EncodeHexScalar(data, length, output);
+			EncodeCharsScalar(data, length, chars);
+		}
+
+		std::memset(output + 3 * length, ' ', hex_size - 3 * length);
+		output[hex_size] = '\t';
+		chars[length] = '\n';
+		return hex_size + 2 + length;
+	}
+
+	// Calls `sink(characters, size)` with whole lines, about `HexDump::ChunkSize` characters at a time
+	template<class Sink>
+	bool EncodeChunks(const ConstByteSpan& data, const std::size_t& column_size, Sink&& sink) {
+		if (data.empty()) {
+			return true;
+		}
+		const std::size_t line_bytes = column_size == 0 ? data.size() : column_size;
+		const std::size_t lines_per_chunk = std::max<std::size_t>(1, HexDump::ChunkSize / LineSize(line_bytes, column_size));
+		const std::size_t chunk_bytes = lines_per_chunk * line_bytes;
+
+		for (std::size_t offset = 0; offset < data.size(); offset += chunk_bytes) {
+			const ConstByteSpan chunk = data.subspan(offset, std::min(chunk_bytes, data.size() - offset));
+			if (!sink(chunk, HexDump::Size(chunk.size(), column_size))) {
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+std::size_t HexDump::Size(const std::size_t& length, const std::size_t& column_size) noexcept {
+	if (length == 0) {
+		return 0;
+	}
+	if (column_size == 0) {
+		return LineSize(length, 0);
+	}
+	const std::size_t remainder = length % column_size;
+	return (length / column_size) * LineSize(column_size, column_size) + (remainder > 0 ? LineSize(remainder, column_size) : 0);
+}
+
+std::size_t HexDump::Encode(const ConstByteSpan& data, const std::size_t& column_size, char* output) noexcept {
+	const auto* bytes = reinterpret_cast<const std::uint8_t*>(data.data());
+	const std::size_t line_bytes = column_size == 0 ? data.size() : column_size;
+	std::size_t written = 0;
+
+	for (std::size_t offset = 0; offset < data.size(); offset += line_bytes) {
+		written += EncodeLine(bytes + offset, std::min(line_bytes, data.size() - offset), column_size, output + written);
+	}
+	return written;
+}
+
+std::string HexDump::Encode(const ConstByteSpan& data, const std::size_t& column_size) {
+	std::string hex_data(Size(data.size(), column_size), '\0');
+	Encode(data, column_size, hex_data.data());
+	return hex_data;
+}
+
+void HexDump::Encode(const ConstByteSpan& data, const std::size_t& column_size, std::ostream& output) {
+	std::string chunk;
+	EncodeChunks(data, column_size, [&](const ConstByteSpan& bytes, const std::size_t& size) {
+		chunk.resize(size);
+		Encode(bytes, column_size, chunk.data());
+		return static_cast<bool>(output.write(chunk.data(), static_cast<std::streamsize>(size)));
+	});
+}
+
+Write::Status HexDump::Encode(const ConstByteSpan& data, const std::size_t& column_size, Producer& output) {
+	Write::Status status = Write::Status::Success;
+	EncodeChunks(data, column_size, [&](const ConstByteSpan& bytes, const std::size_t& size) {
+		Buffers::Data chunk(size);
+		Encode(bytes, column_size, reinterpret_cast<char*>(chunk.data()));
+		status = output.Write(std::move(chunk));
+		return status == Write::Status::Success;
+	});
+	return status;
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+#include <algorithm>
+#include <iosfwd>
+#include <string>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers::HexDump {
+	/**
+	 * @brief Output bytes produced per chunk by the streaming encoders.
+	 */
+	constexpr std::size_t ChunkSize = 64 * 1024;
+
+	/**
+	 * @brief Computes the exact length of a hex dump.
+	 *
+	 * Every line holds `column_size` bytes as `XX ` groups, a tab, their printable characters
+	 * (`.` for the rest) and a newline. The last line is padded so its tab stays aligned.
+	 *
+	 * @param length Number of bytes to dump.
+	 * @param column_size Number of bytes per line; 0 puts everything on a single line.
+	 * @return Number of characters of the dump.
+	 */
+	STORMBYTE_PUBLIC std::size_t 											Size(const std::size_t& length, const std::size_t& column_size) noexcept;
+
+	/**
+	 * @brief Encodes a hex dump into a caller provided buffer.
+	 *
+	 * Uses SSSE3 when the processor supports it and a table driven encoder otherwise.
+	 *
+	 * @param data Bytes to dump.
+	 * @param column_size Number of bytes per line; 0 puts everything on a single line.
+	 * @param output Destination, must hold at least `Size(data.size(), column_size)` characters.
+	 * @return Number of characters written.
+	 */
+	STORMBYTE_PUBLIC std::size_t 											Encode(const ConstByteSpan& data, const std::size_t& column_size, char* output) noexcept;
+
+	/**
+	 * @brief Encodes a hex dump into a string allocated once with its final size.
+	 * @param data Bytes to dump.
+	 * @param column_size Number of bytes per line; 0 puts everything on a single line.
+	 * @return The hex dump.
+	 */
+	STORMBYTE_PUBLIC std::string 											Encode(const ConstByteSpan& data, const std::size_t& column_size);
+
+	/**
+	 * @brief Streams a hex dump to an output stream in chunks of about `ChunkSize` characters.
+	 * @param data Bytes to dump.
+	 * @param column_size Number of bytes per line; 0 puts everything on a single line.
+	 * @param output Stream receiving the dump.
+	 */
+	STORMBYTE_PUBLIC void 													Encode(const ConstByteSpan& data, const std::size_t& column_size, std::ostream& output);
+
+	/**
+	 * @brief Streams a hex dump to a producer in chunks of about `ChunkSize` characters.
+	 *
+	 * Each chunk is a freshly encoded vector moved into the producer, so a bound consumer can
+	 * process the dump while it is being generated. The producer status is left untouched.
+	 *
+	 * @param data Bytes to dump.
+	 * @param column_size Number of bytes per line; 0 puts everything on a single line.
+	 * @param output Producer receiving the dump.
+	 * @return `Write::Status::Success`, or the first failed write status.
+	 */
+	STORMBYTE_PUBLIC Write::Status 											Encode(const ConstByteSpan& data, const std::size_t& column_size, Producer& output);
+
+	/**
+	 * @brief Clamps a range to a span.
+	 * @param data Whole data.
+	 * @param offset First byte of the range.
+	 * @param length Length of the range, clamped to the available data.
+	 * @return The part of `data` covered by the range (empty if `offset` is past the end).
+	 */
+	inline ConstByteSpan 													Range(const ConstByteSpan& data, const std::size_t& offset, const std::size_t& length) noexcept {
+		if (offset >= data.size()) {
+			return {};
+		}
+		return data.subspan(offset, std::min(length, data.size() - offset));
+	}
+}
\ No newline at end of file
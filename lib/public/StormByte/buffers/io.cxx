@@ -0,0 +1,127 @@
+#include <StormByte/buffers/io.hxx>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+
+#ifdef WINDOWS
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+using namespace StormByte::Buffers;
+
+namespace {
+	#ifndef WINDOWS
+	// Regions handed to the kernel per call, kept on the stack
+	constexpr std::size_t MaxVectors = std::min<std::size_t>(IOV_MAX, 64);
+	#endif
+
+	bool WouldBlock(const int& error) noexcept {
+		#ifdef WINDOWS
+		return error == EAGAIN;
+		#else
+		return error == EAGAIN || error == EWOULDBLOCK;
+		#endif
+	}
+}
+
+StormByte::Expected<std::size_t, BufferIOError> IO::Write(const int& fd, std::span<const ConstByteSpan> regions) noexcept {
+	std::size_t total = 0;
+	std::size_t index = 0, offset = 0; // First region (and offset in it) not yet written
+
+	while (index < regions.size()) {
+		if (offset == regions[index].size()) {
+			index++;
+			offset = 0;
+			continue;
+		}
+
+	#ifdef WINDOWS
+		const std::size_t length = std::min<std::size_t>(regions[index].size() - offset, INT_MAX);
+		const auto written = _write(fd, regions[index].data() + offset, static_cast<unsigned int>(length));
+	#else
+		std::array<iovec, MaxVectors> vectors;
+		int count = 0;
+		for (std::size_t i = index; i < regions.size() && count < static_cast<int>(MaxVectors); i++) {
+			const std::size_t skip = i == index ? offset : 0;
+			if (regions[i].size() > skip) {
+				vectors[count++] = { const_cast<Byte*>(regions[i].data() + skip), regions[i].size() - skip };
+			}
+		}
+		const auto written = writev(fd, vectors.data(), count);
+	#endif
+
+		if (written < 0) {
+			const int error = errno;
+			if (error == EINTR) {
+				continue;
+			}
+			if (WouldBlock(error) || total > 0) {
+				// Report what was written; a persistent error shows up on the next call
+				break;
+			}
+			return StormByte::Unexpected<BufferIOError>("Can not write to descriptor {}: {}", fd, std::strerror(error));
+		}
+		if (written == 0) {
+			break;
+		}
+
+		// Advance over the written bytes, possibly spanning several regions
+		std::size_t remaining = static_cast<std::size_t>(written);
+		total += remaining;
+		while (remaining > 0) {
+			const std::size_t available = regions[index].size() - offset;
+			if (remaining < available) {
+				offset += remaining;
+				remaining = 0;
+			} else {
+				remaining -= available;
+				index++;
+				offset = 0;
+			}
+		}
+	}
+
+	return total;
+}
+
+StormByte::Expected<std::size_t, BufferIOError> IO::Read(const int& fd, std::span<const ByteSpan> regions) noexcept {
+	while (true) {
+	#ifdef WINDOWS
+		std::size_t total = 0;
+		int read = 0;
+		for (const auto& region : regions) {
+			read = _read(fd, region.data(), static_cast<unsigned int>(std::min<std::size_t>(region.size(), INT_MAX)));
+			if (read <= 0) {
+				break;
+			}
+			total += static_cast<std::size_t>(read);
+			if (static_cast<std::size_t>(read) < region.size()) {
+				break;
+			}
+		}
+		if (read >= 0 || total > 0) {
+			return total;
+		}
+	#else
+		std::array<iovec, MaxVectors> vectors;
+		int count = 0;
+		for (std::size_t i = 0; i < regions.size() && count < static_cast<int>(MaxVectors); i++) {
+			vectors[count++] = { regions[i].data(), regions[i].size() };
+		}
+		const auto read = readv(fd, vectors.data(), count);
+		if (read >= 0) {
+			return static_cast<std::size_t>(read);
+		}
+	#endif
+		const int error = errno;
+		if (error != EINTR) {
+			return StormByte::Unexpected<BufferIOError>("Can not read from descriptor {}: {}", fd, std::strerror(error));
+		}
+	}
+}
\ No newline at end of file
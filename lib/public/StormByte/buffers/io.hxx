@@ -0,0 +1,43 @@
+#pragma once
+
+#include <StormByte/buffers/exception.hxx>
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers::IO {
+	/**
+	 * @brief Writes several memory regions to a file descriptor with as few system calls as possible.
+	 *
+	 * Regions are written in order using `writev` (one `_write` per region on Windows). Partial writes
+	 * and interruptions are retried until everything is written, the descriptor would block, or an
+	 * error occurs after some data was already written.
+	 *
+	 * @param fd File descriptor to write to.
+	 * @param regions Memory regions to write.
+	 * @return Number of bytes written, or a `BufferIOError` if nothing could be written.
+	 */
+	STORMBYTE_PUBLIC Expected<std::size_t, BufferIOError> 						Write(const int& fd, std::span<const ConstByteSpan> regions) noexcept;
+
+	/**
+	 * @brief Reads from a file descriptor directly into several memory regions.
+	 *
+	 * Performs a single `readv` (one `_read` per region on Windows), retrying only on interruptions.
+	 *
+	 * @param fd File descriptor to read from.
+	 * @param regions Memory regions to fill, in order.
+	 * @return Number of bytes read (0 at end of file), or a `BufferIOError` on failure.
+	 */
+	STORMBYTE_PUBLIC Expected<std::size_t, BufferIOError> 						Read(const int& fd, std::span<const ByteSpan> regions) noexcept;
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include <StormByte/buffers/mapped.hxx>
+#include <StormByte/buffers/hexdump.hxx>
+#include <StormByte/buffers/producer.hxx>
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef WINDOWS
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace StormByte::Buffers;
+
+class Mapped::Region {
+	public:
+		Region(const std::filesystem::path& path): m_data(nullptr), m_size(0) {
+		#ifdef WINDOWS
+			HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file == INVALID_HANDLE_VALUE) {
+				throw Exception("Can not open {} for mapping", path.string());
+			}
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(file, &size)) {
+				CloseHandle(file);
+				throw Exception("Can not get the size of {}", path.string());
+			}
+			m_size = static_cast<std::size_t>(size.QuadPart);
+			if (m_size > 0) {
+				HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (mapping != nullptr) {
+					m_data = static_cast<const Byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+					CloseHandle(mapping); // The view keeps the mapping alive
+				}
+				if (m_data == nullptr) {
+					CloseHandle(file);
+					throw Exception("Can not map {}", path.string());
+				}
+			}
+			CloseHandle(file);
+		#else
+			int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+			if (fd == -1) {
+				throw Exception("Can not open {} for mapping: {}", path.string(), std::strerror(errno));
+			}
+			struct stat info;
+			if (fstat(fd, &info) == -1) {
+				const int error = errno;
+				close(fd);
+				throw Exception("Can not get the size of {}: {}", path.string(), std::strerror(error));
+			}
+			m_size = static_cast<std::size_t>(info.st_size);
+			if (m_size > 0) {
+				void* address = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (address == MAP_FAILED) {
+					const int error = errno;
+					close(fd);
+					throw Exception("Can not map {}: {}", path.string(), std::strerror(error));
+				}
+				m_data = static_cast<const Byte*>(address);
+			}
+			close(fd); // The mapping keeps the file alive
+		#endif
+		}
+
+		Region(const Region&)				= delete;
+		Region& operator=(const Region&)	= delete;
+
+		~Region() noexcept {
+			if (m_data == nullptr) {
+				return;
+			}
+		#ifdef WINDOWS
+			UnmapViewOfFile(m_data);
+		#else
+			munmap(const_cast<Byte*>(m_data), m_size);
+		#endif
+		}
+
+		void Advise(const Advice& advice) const noexcept {
+			if (m_data == nullptr) {
+				return;
+			}
+		#ifdef WINDOWS
+			if (advice == Advice::WillNeed) {
+				WIN32_MEMORY_RANGE_ENTRY range { const_cast<Byte*>(m_data), m_size };
+				PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+			}
+		#else
+			int flag = MADV_NORMAL;
+			switch (advice) {
+				case Advice::Normal:		flag = MADV_NORMAL;		break;
+				case Advice::Sequential:	flag = MADV_SEQUENTIAL;	break;
+				case Advice::Random:		flag = MADV_RANDOM;		break;
+				case Advice::WillNeed:		flag = MADV_WILLNEED;	break;
+			}
+			madvise(const_cast<Byte*>(m_data), m_size, flag);
+		#endif
+		}
+
+		const Byte* m_data;
+		std::size_t m_size;
+};
+
+Mapped::Mapped(const std::filesystem::path& path, const Advice& advice):
+m_region(std::make_shared<const Region>(path)), m_path(path), m_position(0) {
+	m_region->Advise(advice);
+}
+
+void Mapped::Advise(const Advice& advice) const noexcept {
+	m_region->Advise(advice);
+}
+
+std::size_t Mapped::AvailableBytes() const noexcept {
+	return m_position < m_region->m_size ? m_region->m_size - m_position : 0;
+}
+
+Consumer Mapped::Consumer() const {
+	Producer producer;
+	const std::size_t start = std::min(m_position, m_region->m_size);
+
+	// The buffer refers to the mapping and owns a reference to the region, keeping it alive if needed
+	producer << Simple(ConstByteSpan(m_region->m_data + start, m_region->m_size - start), m_region);
+	producer << Status::ReadOnly;
+	return producer.Consumer();
+}
+
+StormByte::Buffers::Data Mapped::Data() const {
+	return Buffers::Data(m_region->m_data, m_region->m_data + m_region->m_size);
+}
+
+bool Mapped::Empty() const noexcept {
+	return m_region->m_size == 0;
+}
+
+bool Mapped::End() const noexcept {
+	return m_position == m_region->m_size;
+}
+
+bool Mapped::HasEnoughData(const std::size_t& length) const noexcept {
+	return m_position + length <= m_region->m_size;
+}
+
+std::string Mapped::HexData(const std::size_t& column_size) const {
+	return HexDump::Encode(Span(), column_size);
+}
+
+bool Mapped::IsEoF() const noexcept {
+	return m_position >= m_region->m_size;
+}
+
+const std::filesystem::path& Mapped::Path() const noexcept {
+	return m_path;
+}
+
+ExpectedByte<BufferOverflow> Mapped::Peek() const {
+	if (m_position >= m_region->m_size) {
+		return StormByte::Unexpected<BufferOverflow>(
+			"Cannot peek: no more data available in the buffer."
+		);
+	}
+	return m_region->m_data[m_position];
+}
+
+ExpectedConstByteSpan<BufferOverflow> Mapped::PeekView(const std::size_t& length) const {
+	if (!HasEnoughData(length)) {
+		return StormByte::Unexpected<BufferOverflow>(
+			"Insufficient data to view {} bytes (only have {} bytes)",
+			length,
+			AvailableBytes());
+	}
+	return std::span<const Byte>(m_region->m_data + m_position, length);
+}
+
+std::size_t Mapped::Position() const noexcept {
+	return m_position;
+}
+
+ExpectedData<BufferOverflow> Mapped::Read(const std::size_t& length) const {
+	auto view = ReadView(length);
+	if (!view) {
+		return StormByte::Unexpected(view.error());
+	}
+	return Buffers::Data(view->begin(), view->end());
+}
+
+ExpectedConstByteSpan<BufferOverflow> Mapped::ReadView(const std::size_t& length) const {
+	auto view = PeekView(length);
+	if (view) {
+		m_position += length;
+	}
+	return view;
+}
+
+void Mapped::Seek(const std::ptrdiff_t& position, const Read::Position& mode) const {
+	std::size_t new_position = 0;
+
+	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Begin)) {
+		new_position = static_cast<std::size_t>(std::max<ptrdiff_t>(0, position));
+	}
+	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::End)) {
+		new_position = static_cast<std::size_t>(
+			std::max<ptrdiff_t>(0, static_cast<ptrdiff_t>(m_region->m_size) + position));
+	}
+	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Relative)) {
+		new_position = static_cast<std::size_t>(
+			std::max<ptrdiff_t>(0, static_cast<ptrdiff_t>(m_position) + position));
+	}
+	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Absolute)) {
+		new_position = static_cast<std::size_t>(std::max<ptrdiff_t>(0, position));
+	}
+
+	m_position = new_position;
+}
+
+std::size_t Mapped::Size() const noexcept {
+	return m_region->m_size;
+}
+
+std::span<const Byte> Mapped::Span() const noexcept {
+	return std::span<const Byte>(m_region->m_data, m_region->m_size);
+}
\ No newline at end of file
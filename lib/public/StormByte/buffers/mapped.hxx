@@ -0,0 +1,227 @@
+#pragma once
+
+#include <StormByte/buffers/consumer.hxx>
+#include <StormByte/buffers/exception.hxx>
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers {
+	/**
+	 * @class Mapped
+	 * @brief A read-only buffer backed by a memory-mapped file.
+	 *
+	 * The `Mapped` class maps a file into memory and exposes the same read API as `Simple`, so files can be
+	 * parsed directly from the page cache without first reading them into a vector.
+	 *
+	 * **Key Features:**
+	 * - **No Upfront Copy**: Pages are loaded by the operating system as they are touched.
+	 * - **Access Hints**: The expected access pattern is forwarded to the kernel (`madvise` on Linux).
+	 * - **Cheap Copies**: Copies share the mapping and keep it alive; each copy has its own read position.
+	 * - **Consumer Adapter**: `Consumer()` hands the mapping, uncopied, to a producer/consumer pair for use in pipelines.
+	 *
+	 * The mapped contents must not be truncated by other processes while mapped. This class is not thread-safe,
+	 * but distinct copies may be read from different threads.
+	 */
+	class STORMBYTE_PUBLIC Mapped final {
+		public:
+			/**
+			 * @enum Advice
+			 * @brief Expected access pattern for the mapped pages.
+			 */
+			enum class Advice: unsigned short {
+				Normal,																///< No special treatment.
+				Sequential,															///< Pages are read in order, read ahead aggressively and drop behind.
+				Random,																///< Pages are read in random order, do not read ahead.
+				WillNeed															///< Pages will be needed soon, start loading them now.
+			};
+
+			/**
+			 * @brief Maps a file for reading
+			 * @param path Path of the file to map.
+			 * @param advice Expected access pattern. Defaults to `Advice::Sequential`.
+			 * @throw Buffers::Exception if the file can't be opened or mapped.
+			 */
+			explicit Mapped(const std::filesystem::path& path, const Advice& advice = Advice::Sequential);
+
+			/**
+			 * @brief Copy constructor
+			 * The copy shares the mapping and starts at the same read position.
+			 * @param other Mapped buffer to copy from.
+			 */
+			Mapped(const Mapped& other)												= default;
+
+			/**
+			 * @brief Move constructor
+			 * @param other Mapped buffer to move from.
+			 */
+			Mapped(Mapped&& other) noexcept											= default;
+
+			/**
+			 * @brief Destructor
+			 * The file is unmapped once the last copy is destroyed.
+			 */
+			~Mapped() noexcept 														= default;
+
+			/**
+			 * @brief Copy assignment operator
+			 * @param other Mapped buffer to copy from.
+			 * @return Reference to the updated mapped buffer.
+			 */
+			Mapped& operator=(const Mapped& other)									= default;
+
+			/**
+			 * @brief Move assignment operator
+			 * @param other Mapped buffer to move from.
+			 * @return Reference to the updated mapped buffer.
+			 */
+			Mapped& operator=(Mapped&& other) noexcept								= default;
+
+			/**
+			 * @brief Changes the expected access pattern for the whole mapping
+			 * @param advice Expected access pattern.
+			 * @note This is only a hint and it is ignored on platforms not supporting it.
+			 */
+			void 																	Advise(const Advice& advice) const noexcept;
+
+			/**
+			 * @brief Gets the available bytes to read from current position
+			 * @return Number of bytes available to read.
+			 */
+			std::size_t 															AvailableBytes() const noexcept;
+
+			/**
+			 * @brief Hands the mapped contents to a producer/consumer pair.
+			 *
+			 * The returned consumer's buffer refers to the mapping without copying it and is already marked
+			 * as `Status::ReadOnly`. The mapping is kept alive while the buffer refers to it, so this instance
+			 * can be destroyed meanwhile.
+			 *
+			 * @return A `Consumer` holding the file contents starting at the current read position.
+			 */
+			Buffers::Consumer 														Consumer() const;
+
+			/**
+			 * @brief Retrieves a copy of the mapped data.
+			 * @return A copy of the whole file contents.
+			 */
+			Buffers::Data 															Data() const;
+
+			/**
+			 * @brief Checks if the mapped file is empty
+			 * @return True if the file is empty, false otherwise.
+			 */
+			bool 																	Empty() const noexcept;
+
+			/**
+			 * @brief Checks if the read position is at the end
+			 * @return True if the read position is at the end, false otherwise.
+			 */
+			bool 																	End() const noexcept;
+
+			/**
+			 * @brief Checks if there is enough data starting from the current read position.
+			 * @param length Length of the data to check.
+			 * @return True if enough data is available, false otherwise.
+			 */
+			bool 																	HasEnoughData(const std::size_t& length) const noexcept;
+
+			/**
+			 * @brief Retrieves the stored value as a hexadecimal string.
+			 * @param column_size Number of bytes per column in the output. Defaults to 16.
+			 * @return Hexadecimal string representation of the stored value.
+			 * @see Simple::HexData
+			 */
+			std::string 															HexData(const std::size_t& column_size = 16) const;
+
+			/**
+			 * @brief Checks if the buffer is at the end of the data
+			 * @return True if the buffer is at the end, false otherwise.
+			 */
+			bool 																	IsEoF() const noexcept;
+
+			/**
+			 * @brief Retrieves the mapped file path
+			 * @return The path given at construction.
+			 */
+			const std::filesystem::path& 											Path() const noexcept;
+
+			/**
+			 * @brief Retrieves the next byte without incrementing the read position.
+			 * @return `ExpectedByte` containing the next byte, or an `Unexpected`
+			 *         with a `BufferOverflow` error if there is no more data.
+			 */
+			ExpectedByte<BufferOverflow>											Peek() const;
+
+			/**
+			 * @brief Retrieves a view of the next bytes without advancing the read position.
+			 * @param length Number of bytes to view.
+			 * @return `ExpectedConstByteSpan` valid while any copy of this mapping is alive, or an
+			 *         `Unexpected` with a `BufferOverflow` error if insufficient data exists.
+			 */
+			ExpectedConstByteSpan<BufferOverflow> 									PeekView(const std::size_t& length) const;
+
+			/**
+			 * @brief Retrieves the read position
+			 * @return Current read position in the mapped buffer.
+			 */
+			std::size_t 															Position() const noexcept;
+
+			/**
+			 * @brief Reads a specific size of data starting from the current read position.
+			 * @param length Length of the data to read.
+			 * @return `ExpectedData` containing a copy of the requested data, or an
+			 *         `Unexpected` with a `BufferOverflow` error if insufficient data exists.
+			 */
+			ExpectedData<BufferOverflow> 											Read(const std::size_t& length) const;
+
+			/**
+			 * @brief Retrieves a view of the next bytes and advances the read position.
+			 * @param length Number of bytes to view.
+			 * @return `ExpectedConstByteSpan` valid while any copy of this mapping is alive, or an
+			 *         `Unexpected` with a `BufferOverflow` error if insufficient data exists.
+			 */
+			ExpectedConstByteSpan<BufferOverflow> 									ReadView(const std::size_t& length) const;
+
+			/**
+			 * @brief Moves the read pointer within the mapped buffer.
+			 * @param position The position to move to, interpreted based on the specified mode.
+			 * @param mode The mode to use for seeking (e.g., `Begin`, `End`, `Relative`, `Absolute`).
+			 */
+			void 																	Seek(const std::ptrdiff_t& position, const Read::Position& mode) const;
+
+			/**
+			 * @brief Retrieves the length of the mapped file
+			 * @return Length of the mapped file.
+			 */
+			std::size_t 															Size() const noexcept;
+
+			/**
+			 * @brief Retrieves a read-only view of the whole mapping.
+			 * @return A span valid while any copy of this mapping is alive.
+			 */
+			std::span<const Byte> 													Span() const noexcept;
+
+		private:
+			class Region;															///< Platform specific mapping, defined in the implementation.
+
+			std::shared_ptr<const Region> m_region;									///< Mapping shared between copies.
+			std::filesystem::path m_path;											///< Mapped file path.
+			mutable std::size_t m_position;											///< Read position.
+	};
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include <StormByte/buffers/metrics.hxx>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+using namespace StormByte::Buffers::Metrics;
+
+std::uint64_t Histogram::Count() const noexcept {
+	std::uint64_t count = 0;
+	for (const auto& bucket: counts) {
+		count += bucket;
+	}
+	return count;
+}
+
+std::chrono::nanoseconds Histogram::Percentile(const double& fraction) const noexcept {
+	const std::uint64_t count = Count();
+	if (count == 0) {
+		return std::chrono::nanoseconds(0);
+	}
+	const auto rank = static_cast<std::uint64_t>(std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(count)));
+	std::uint64_t seen = 0;
+	for (std::size_t i = 0; i < Buckets; i++) {
+		seen += counts[i];
+		if (seen >= std::max<std::uint64_t>(rank, 1)) {
+			return std::chrono::nanoseconds(std::int64_t(1) << (i + 1));
+		}
+	}
+	return std::chrono::nanoseconds(std::int64_t(1) << Buckets);
+}
+
+void Recorder::Record(const std::chrono::nanoseconds& duration) noexcept {
+	const auto nanoseconds = static_cast<std::uint64_t>(std::max<std::int64_t>(duration.count(), 0));
+	const std::size_t bucket = nanoseconds < 2 ? 0 : std::min<std::size_t>(std::bit_width(nanoseconds) - 1, Histogram::Buckets - 1);
+	m_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+Histogram Recorder::Snapshot() const noexcept {
+	Histogram histogram;
+	for (std::size_t i = 0; i < Histogram::Buckets; i++) {
+		histogram.counts[i] = m_counts[i].load(std::memory_order_relaxed);
+	}
+	return histogram;
+}
+
+Histogram Mutex::HoldTimes() const noexcept {
+	return m_hold.Snapshot();
+}
+
+Histogram Mutex::WaitTimes() const noexcept {
+	return m_wait.Snapshot();
+}
+
+void Mutex::lock() {
+	// Uncontended locks skip reading the clock for their wait
+	if (!m_mutex.try_lock()) {
+		const auto start = std::chrono::steady_clock::now();
+		m_mutex.lock();
+		m_locked_at = std::chrono::steady_clock::now();
+		m_wait.Record(m_locked_at - start);
+		return;
+	}
+	m_locked_at = std::chrono::steady_clock::now();
+	m_wait.Record(std::chrono::nanoseconds(0));
+}
+
+void Mutex::lock_shared() {
+	if (!m_mutex.try_lock_shared()) {
+		const auto start = std::chrono::steady_clock::now();
+		m_mutex.lock_shared();
+		m_wait.Record(std::chrono::steady_clock::now() - start);
+		return;
+	}
+	m_wait.Record(std::chrono::nanoseconds(0));
+}
+
+bool Mutex::try_lock() {
+	if (!m_mutex.try_lock()) {
+		return false;
+	}
+	m_locked_at = std::chrono::steady_clock::now();
+	m_wait.Record(std::chrono::nanoseconds(0));
+	return true;
+}
+
+bool Mutex::try_lock_shared() {
+	if (!m_mutex.try_lock_shared()) {
+		return false;
+	}
+	m_wait.Record(std::chrono::nanoseconds(0));
+	return true;
+}
+
+void Mutex::unlock() {
+	// Read before unlocking: the next holder overwrites it
+	m_hold.Record(std::chrono::steady_clock::now() - m_locked_at);
+	m_mutex.unlock();
+}
+
+void Mutex::unlock_shared() {
+	m_mutex.unlock_shared();
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <StormByte/buffers/config.hxx>
+#include <StormByte/visibility.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+
+/**
+ * @namespace Metrics
+ * @brief Contention and throughput instrumentation for `Shared` buffers.
+ *
+ * Counters are only kept when the library is built with `STORMBYTE_BUFFER_METRICS` defined (the
+ * `ENABLE_BUFFER_METRICS` CMake option). Otherwise `Counters` does nothing, `SharedMutex` is a plain
+ * `std::shared_mutex` and the metrics fields of @see Shared::Statistics stay zero, so the buffers pay nothing.
+ * The definition comes from the generated `config.hxx`, so code using the library sees the layout of `Shared` it was built with.
+ */
+namespace StormByte::Buffers::Metrics {
+	#ifdef STORMBYTE_BUFFER_METRICS
+	inline constexpr bool Enabled = true;													///< Metrics are compiled in.
+	#else
+	inline constexpr bool Enabled = false;													///< Metrics are compiled out.
+	#endif
+
+	/**
+	 * @struct Histogram
+	 * @brief Snapshot of a distribution of durations.
+	 *
+	 * Bucket `i` counts the durations from 2^i up to 2^(i+1) nanoseconds, the first one also counts zero
+	 * and the last one everything longer.
+	 */
+	struct STORMBYTE_PUBLIC Histogram {
+		static constexpr std::size_t Buckets = 32;											///< Number of buckets, the last one starts past 2 seconds.
+
+		std::array<std::uint64_t, Buckets> counts {};										///< Durations recorded per bucket.
+
+		/**
+		 * @brief Retrieves the number of recorded durations
+		 * @return Sum of every bucket.
+		 */
+		std::uint64_t 																		Count() const noexcept;
+
+		/**
+		 * @brief Estimates a percentile of the recorded durations
+		 * @param fraction Fraction of the durations, between 0 and 1 (0.99 for the 99th percentile).
+		 * @return Upper bound of the bucket holding the percentile, zero if nothing was recorded.
+		 */
+		std::chrono::nanoseconds 															Percentile(const double& fraction) const noexcept;
+	};
+
+	/**
+	 * @class Recorder
+	 * @brief Thread-safe accumulator behind a @see Histogram.
+	 */
+	class STORMBYTE_PUBLIC Recorder final {
+		public:
+			/**
+			 * @brief Records a duration
+			 * @param duration Duration to record.
+			 */
+			void 																			Record(const std::chrono::nanoseconds& duration) noexcept;
+
+			/**
+			 * @brief Retrieves the recorded distribution
+			 * @return Current histogram.
+			 */
+			Histogram 																		Snapshot() const noexcept;
+
+		private:
+			std::array<std::atomic<std::uint64_t>, Histogram::Buckets> m_counts {};			///< Durations recorded per bucket.
+	};
+
+	/**
+	 * @class Mutex
+	 * @brief A `std::shared_mutex` recording how long locks are waited for and held.
+	 *
+	 * Every acquisition records its wait, which is zero when the lock was free. Hold times are recorded
+	 * for exclusive locks only: they are the time readers and other writers are kept out.
+	 * It meets the *SharedMutex* requirements, so it works with `std::unique_lock` and `std::shared_lock`.
+	 */
+	class STORMBYTE_PUBLIC Mutex final {
+		public:
+			/**
+			 * @brief Retrieves the exclusive hold times
+			 * @return Current histogram.
+			 */
+			Histogram 																		HoldTimes() const noexcept;
+
+			/**
+			 * @brief Retrieves the lock wait times, shared and exclusive
+			 * @return Current histogram.
+			 */
+			Histogram 																		WaitTimes() const noexcept;
+
+			/**
+			 * @brief Locks exclusively
+			 */
+			void 																			lock();
+
+			/**
+			 * @brief Locks shared
+			 */
+			void 																			lock_shared();
+
+			/**
+			 * @brief Tries to lock exclusively without waiting
+			 * @return True if locked.
+			 */
+			bool 																			try_lock();
+
+			/**
+			 * @brief Tries to lock shared without waiting
+			 * @return True if locked.
+			 */
+			bool 																			try_lock_shared();
+
+			/**
+			 * @brief Unlocks an exclusive lock
+			 */
+			void 																			unlock();
+
+			/**
+			 * @brief Unlocks a shared lock
+			 */
+			void 																			unlock_shared();
+
+		private:
+			std::shared_mutex m_mutex;														///< Actual lock.
+			Recorder m_wait;																///< Time spent acquiring the lock.
+			Recorder m_hold;																///< Time the lock was held exclusively.
+			std::chrono::steady_clock::time_point m_locked_at;								///< When the current exclusive lock was taken.
+	};
+
+	#ifdef STORMBYTE_BUFFER_METRICS
+	using SharedMutex = Mutex;																///< Mutex guarding `Shared` buffers.
+
+	/**
+	 * @class Counters
+	 * @brief Throughput counters of a `Shared` buffer.
+	 */
+	class STORMBYTE_PUBLIC Counters final {
+		public:
+			std::uint64_t BytesExtracted() const noexcept { return m_bytes_extracted.load(std::memory_order_relaxed); }	///< Bytes removed by extractions.
+			std::uint64_t BytesRead() const noexcept { return m_bytes_read.load(std::memory_order_relaxed); }	///< Bytes passed by reads.
+			std::uint64_t BytesWritten() const noexcept { return m_bytes_written.load(std::memory_order_relaxed); }	///< Bytes appended.
+			std::size_t PeakSize() const noexcept { return m_peak_size.load(std::memory_order_relaxed); }	///< Largest number of unread bytes seen.
+			std::uint64_t Reads() const noexcept { return m_reads.load(std::memory_order_relaxed); }	///< Read and extract operations.
+			std::chrono::nanoseconds WaitTime() const noexcept { return std::chrono::nanoseconds(m_wait_nanoseconds.load(std::memory_order_relaxed)); }	///< Time readers slept waiting for data.
+			std::uint64_t Writes() const noexcept { return m_writes.load(std::memory_order_relaxed); }	///< Write operations.
+
+			/**
+			 * @brief Counts an extraction
+			 * @param bytes Bytes extracted.
+			 */
+			void Extracted(const std::size_t& bytes) noexcept {
+				m_bytes_extracted.fetch_add(bytes, std::memory_order_relaxed);
+				m_reads.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Counts a read advancing the read position
+			 * @param bytes Bytes read.
+			 */
+			void Read(const std::size_t& bytes) noexcept {
+				m_bytes_read.fetch_add(bytes, std::memory_order_relaxed);
+				m_reads.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Tracks the peak of unread bytes
+			 * @param unread Unread bytes currently stored.
+			 */
+			void Stored(const std::size_t& unread) noexcept {
+				std::size_t peak = m_peak_size.load(std::memory_order_relaxed);
+				while (unread > peak && !m_peak_size.compare_exchange_weak(peak, unread, std::memory_order_relaxed)) {}
+			}
+
+			/**
+			 * @brief Counts time a reader slept waiting for data
+			 * @param time Time slept.
+			 */
+			void Waited(const std::chrono::nanoseconds& time) noexcept {
+				m_wait_nanoseconds.fetch_add(static_cast<std::uint64_t>(time.count()), std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Counts a write
+			 * @param bytes Bytes written.
+			 */
+			void Written(const std::size_t& bytes) noexcept {
+				m_bytes_written.fetch_add(bytes, std::memory_order_relaxed);
+				m_writes.fetch_add(1, std::memory_order_relaxed);
+			}
+
+		private:
+			std::atomic<std::uint64_t> m_bytes_extracted {0};								///< Bytes removed by extractions.
+			std::atomic<std::uint64_t> m_bytes_read {0};									///< Bytes passed by reads.
+			std::atomic<std::uint64_t> m_bytes_written {0};									///< Bytes appended.
+			std::atomic<std::size_t> m_peak_size {0};										///< Largest number of unread bytes seen.
+			std::atomic<std::uint64_t> m_reads {0};											///< Read and extract operations.
+			std::atomic<std::uint64_t> m_wait_nanoseconds {0};								///< Time readers slept waiting for data.
+			std::atomic<std::uint64_t> m_writes {0};										///< Write operations.
+	};
+	#else
+	using SharedMutex = std::shared_mutex;													///< Mutex guarding `Shared` buffers.
+
+	/**
+	 * @class Counters
+	 * @brief Compiled out throughput counters: every call does nothing and every counter reads zero.
+	 */
+	class STORMBYTE_PUBLIC Counters final {
+		public:
+			constexpr std::uint64_t BytesExtracted() const noexcept { return 0; }	///< Bytes removed by extractions.
+			constexpr std::uint64_t BytesRead() const noexcept { return 0; }	///< Bytes passed by reads.
+			constexpr std::uint64_t BytesWritten() const noexcept { return 0; }	///< Bytes appended.
+			constexpr std::size_t PeakSize() const noexcept { return 0; }	///< Largest number of unread bytes seen.
+			constexpr std::uint64_t Reads() const noexcept { return 0; }	///< Read and extract operations.
+			constexpr std::chrono::nanoseconds WaitTime() const noexcept { return std::chrono::nanoseconds(0); }	///< Time readers slept waiting for data.
+			constexpr std::uint64_t Writes() const noexcept { return 0; }	///< Write operations.
+			constexpr void Extracted(const std::size_t&) noexcept {}
+			constexpr void Read(const std::size_t&) noexcept {}
+			constexpr void Stored(const std::size_t&) noexcept {}
+			constexpr void Waited(const std::chrono::nanoseconds&) noexcept {}
+			constexpr void Written(const std::size_t&) noexcept {}
+	};
+	#endif
+}
@@ -0,0 +1,215 @@
+#include <StormByte/buffers/pool.hxx>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <vector>
+
+using namespace StormByte::Buffers;
+
+namespace {
+	constexpr std::size_t BlockAlignment	= Pool::MinimumBlockSize;
+	constexpr std::size_t ClassCount		= std::bit_width(Pool::MaximumBlockSize) - std::bit_width(Pool::MinimumBlockSize) + 1;
+
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+
+	struct FreeList {
+		FreeBlock* head = nullptr;
+		std::size_t count = 0;
+
+		void Push(void* block) noexcept {
+			auto* free_block = static_cast<FreeBlock*>(block);
+			free_block->next = head;
+			head = free_block;
+			count++;
+		}
+
+		void* Pop() noexcept {
+			FreeBlock* block = head;
+			head = block->next;
+			count--;
+			return block;
+		}
+	};
+
+	std::size_t ClassIndex(const std::size_t& bytes) noexcept {
+		if (bytes <= Pool::MinimumBlockSize) {
+			return 0;
+		}
+		return std::bit_width(bytes - 1) - std::bit_width(Pool::MinimumBlockSize - 1);
+	}
+
+	constexpr std::size_t ClassSize(const std::size_t& index) noexcept {
+		return Pool::MinimumBlockSize << index;
+	}
+
+	std::atomic<std::uint64_t> g_next_pool_id { 1 };
+}
+
+class Pool::Central {
+	public:
+		Central(std::pmr::memory_resource* upstream):
+		m_upstream(upstream), m_id(g_next_pool_id.fetch_add(1, std::memory_order_relaxed)),
+		m_allocations(0), m_deallocations(0), m_cache_hits(0), m_upstream_allocations(0), m_slabs(0), m_in_use(0) {}
+
+		~Central() noexcept {
+			for (void* slab : m_slab_list) {
+				m_upstream->deallocate(slab, SlabSize, BlockAlignment);
+			}
+		}
+
+		// Moves up to `count` blocks of a size class into `list`, carving a new slab if needed
+		void Take(const std::size_t& index, FreeList& list, const std::size_t& count) {
+			SizeClass& size_class = m_classes[index];
+			std::lock_guard<std::mutex> lock(size_class.mutex);
+			if (size_class.free.head == nullptr) {
+				Carve(index, size_class.free);
+			}
+			for (std::size_t i = 0; i < count && size_class.free.head != nullptr; i++) {
+				list.Push(size_class.free.Pop());
+			}
+		}
+
+		// Moves `count` blocks from `list` back to the central free list
+		void Give(const std::size_t& index, FreeList& list, const std::size_t& count) noexcept {
+			SizeClass& size_class = m_classes[index];
+			std::lock_guard<std::mutex> lock(size_class.mutex);
+			for (std::size_t i = 0; i < count && list.head != nullptr; i++) {
+				size_class.free.Push(list.Pop());
+			}
+		}
+
+		std::pmr::memory_resource* const m_upstream;
+		const std::uint64_t m_id;
+		std::atomic<std::uint64_t> m_allocations, m_deallocations, m_cache_hits, m_upstream_allocations, m_slabs;
+		std::atomic<std::size_t> m_in_use;
+
+	private:
+		struct SizeClass {
+			std::mutex mutex;
+			FreeList free;
+		};
+
+		std::array<SizeClass, ClassCount> m_classes;
+		std::mutex m_slab_mutex;
+		std::vector<void*> m_slab_list;
+
+		void Carve(const std::size_t& index, FreeList& list) {
+			void* slab = m_upstream->allocate(SlabSize, BlockAlignment);
+			{
+				std::lock_guard<std::mutex> lock(m_slab_mutex);
+				m_slab_list.push_back(slab);
+			}
+			m_slabs.fetch_add(1, std::memory_order_relaxed);
+
+			const std::size_t block_size = ClassSize(index);
+			auto* bytes = static_cast<Byte*>(slab);
+			// Push in reverse so blocks are handed out in address order
+			for (std::size_t offset = SlabSize; offset >= block_size; offset -= block_size) {
+				list.Push(bytes + offset - block_size);
+			}
+		}
+};
+
+// Per thread free lists, one entry per pool used by the thread
+class Pool::ThreadCache {
+	public:
+		struct Entry {
+			std::uint64_t id;
+			std::weak_ptr<Central> central;
+			std::array<FreeList, ClassCount> lists;
+		};
+
+		~ThreadCache() noexcept {
+			for (auto& entry : m_entries) {
+				// Blocks of destroyed pools went away with their slabs
+				if (auto central = entry.central.lock()) {
+					for (std::size_t index = 0; index < ClassCount; index++) {
+						central->Give(index, entry.lists[index], entry.lists[index].count);
+					}
+				}
+			}
+		}
+
+		Entry& Find(const std::shared_ptr<Central>& central) {
+			for (auto& entry : m_entries) {
+				if (entry.id == central->m_id) {
+					return entry;
+				}
+			}
+			std::erase_if(m_entries, [](const Entry& entry) { return entry.central.expired(); });
+			return m_entries.emplace_back(Entry { central->m_id, central, {} });
+		}
+
+	private:
+		std::vector<Entry> m_entries;
+};
+
+Pool::ThreadCache& Pool::Cache() noexcept {
+	thread_local ThreadCache cache;
+	return cache;
+}
+
+Pool::Pool(std::pmr::memory_resource* upstream): m_central(std::make_shared<Central>(upstream)) {}
+
+Pool::~Pool() noexcept = default;
+
+Pool::Statistics Pool::Stats() const noexcept {
+	return {
+		m_central->m_allocations.load(std::memory_order_relaxed),
+		m_central->m_deallocations.load(std::memory_order_relaxed),
+		m_central->m_cache_hits.load(std::memory_order_relaxed),
+		m_central->m_upstream_allocations.load(std::memory_order_relaxed),
+		m_central->m_slabs.load(std::memory_order_relaxed),
+		static_cast<std::size_t>(m_central->m_slabs.load(std::memory_order_relaxed)) * SlabSize,
+		m_central->m_in_use.load(std::memory_order_relaxed)
+	};
+}
+
+std::pmr::memory_resource* Pool::Upstream() const noexcept {
+	return m_central->m_upstream;
+}
+
+void* Pool::do_allocate(std::size_t bytes, std::size_t alignment) {
+	if (bytes > MaximumBlockSize || alignment > BlockAlignment) {
+		m_central->m_upstream_allocations.fetch_add(1, std::memory_order_relaxed);
+		return m_central->m_upstream->allocate(bytes, alignment);
+	}
+
+	const std::size_t index = ClassIndex(bytes);
+	FreeList& list = Cache().Find(m_central).lists[index];
+	if (list.head == nullptr) {
+		m_central->Take(index, list, ThreadCacheSize / 2);
+	} else {
+		m_central->m_cache_hits.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	m_central->m_allocations.fetch_add(1, std::memory_order_relaxed);
+	m_central->m_in_use.fetch_add(ClassSize(index), std::memory_order_relaxed);
+	return list.Pop();
+}
+
+void Pool::do_deallocate(void* block, std::size_t bytes, std::size_t alignment) {
+	if (bytes > MaximumBlockSize || alignment > BlockAlignment) {
+		m_central->m_upstream->deallocate(block, bytes, alignment);
+		return;
+	}
+
+	const std::size_t index = ClassIndex(bytes);
+	FreeList& list = Cache().Find(m_central).lists[index];
+	list.Push(block);
+	if (list.count > ThreadCacheSize) {
+		m_central->Give(index, list, ThreadCacheSize / 2);
+	}
+
+	m_central->m_deallocations.fetch_add(1, std::memory_order_relaxed);
+	m_central->m_in_use.fetch_sub(ClassSize(index), std::memory_order_relaxed);
+}
+
+bool Pool::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+	return this == &other;
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers {
+	/**
+	 * @class Pool
+	 * @brief A thread-safe size-class slab allocator usable as a `std::pmr::memory_resource`.
+	 *
+	 * Requests are rounded up to a power of two between `MinimumBlockSize` and `MaximumBlockSize` and served
+	 * from slabs obtained from the upstream resource. Freed blocks are kept in a small per-thread cache,
+	 * so the common allocate/free cycle of a buffer never takes a lock nor reaches the global allocator.
+	 * Larger or over-aligned requests are forwarded to the upstream resource.
+	 *
+	 * **Usage:**
+	 * - Pass it to `Simple`, `Shared` or `Producer` constructors to pool a specific buffer.
+	 * - Use it as the allocator of a `Buffers::pmr::Data` to pool a vector of your own.
+	 *
+	 * Slabs are only returned to the upstream resource when the pool is destroyed, so the pool must
+	 * outlive every buffer allocated from it.
+	 */
+	class STORMBYTE_PUBLIC Pool final: public std::pmr::memory_resource {
+		public:
+			static constexpr std::size_t MinimumBlockSize	= 64;					///< Smallest size class.
+			static constexpr std::size_t MaximumBlockSize	= 64 * 1024;			///< Largest size class, bigger requests go upstream.
+			static constexpr std::size_t SlabSize			= 256 * 1024;			///< Bytes requested upstream when a size class runs dry.
+			static constexpr std::size_t ThreadCacheSize	= 32;					///< Blocks cached per thread and size class.
+
+			/**
+			 * @struct Statistics
+			 * @brief Snapshot of the pool counters.
+			 */
+			struct Statistics {
+				std::uint64_t allocations;											///< Blocks handed out by the pool.
+				std::uint64_t deallocations;										///< Blocks given back to the pool.
+				std::uint64_t cache_hits;											///< Allocations served from a thread cache.
+				std::uint64_t upstream_allocations;									///< Large or over-aligned requests forwarded upstream.
+				std::uint64_t slabs;												///< Slabs obtained from upstream.
+				std::size_t reserved_bytes;											///< Bytes held in slabs.
+				std::size_t in_use_bytes;											///< Bytes currently handed out from slabs.
+			};
+
+			/**
+			 * @brief Constructor
+			 * @param upstream Resource providing the slabs and serving large requests.
+			 */
+			explicit Pool(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+			/**
+			 * @brief Deleted copy constructor
+			 */
+			Pool(const Pool& other)													= delete;
+
+			/**
+			 * @brief Deleted move constructor
+			 */
+			Pool(Pool&& other)														= delete;
+
+			/**
+			 * @brief Destructor
+			 * Returns every slab to the upstream resource.
+			 */
+			~Pool() noexcept override;
+
+			/**
+			 * @brief Deleted copy assignment operator
+			 */
+			Pool& operator=(const Pool& other)										= delete;
+
+			/**
+			 * @brief Deleted move assignment operator
+			 */
+			Pool& operator=(Pool&& other)											= delete;
+
+			/**
+			 * @brief Retrieves a snapshot of the pool counters
+			 * @return Current statistics.
+			 */
+			Statistics 																Stats() const noexcept;
+
+			/**
+			 * @brief Retrieves the upstream resource
+			 * @return Pointer to the upstream resource.
+			 */
+			std::pmr::memory_resource* 												Upstream() const noexcept;
+
+		private:
+			class Central;															///< Shared state, defined in the implementation.
+			class ThreadCache;														///< Per thread free lists, defined in the implementation.
+
+			std::shared_ptr<Central> m_central;										///< Slabs and central free lists (thread caches hold weak references).
+
+			/**
+			 * @brief Retrieves the calling thread's cache
+			 * @return Thread cache shared by every pool.
+			 */
+			static ThreadCache& 													Cache() noexcept;
+
+			void* 																	do_allocate(std::size_t bytes, std::size_t alignment) override;
+			void 																	do_deallocate(void* block, std::size_t bytes, std::size_t alignment) override;
+			bool 																	do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+	};
+}
\ No newline at end of file
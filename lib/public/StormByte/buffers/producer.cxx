@@ -1,66 +1,146 @@
 #include <StormByte/buffers/producer.hxx>
 #include <StormByte/buffers/consumer.hxx>
 
+#include <algorithm>
+
 using namespace StormByte::Buffers;
 
 // Default constructor
-Producer::Producer() noexcept: m_shared(std::make_shared<Shared>()) {}
+Producer::Producer() noexcept: m_shared(std::make_shared<Shared>()), m_coalesce(0) {}
+
+Producer::Producer(std::pmr::memory_resource& resource): m_shared(std::make_shared<Shared>(resource)), m_coalesce(0) {}
+
+Producer::Producer(Ring&& ring): m_shared(std::make_shared<Shared>(std::move(ring))), m_coalesce(0) {}
+
+Producer::Producer(const Shared& shared) noexcept: m_shared(std::make_shared<Shared>(shared)), m_coalesce(0) {}
+
+Producer::Producer(Shared&& shared) noexcept: m_shared(std::make_shared<Shared>(std::move(shared))), m_coalesce(0) {}
 
-Producer::Producer(const Shared& shared) noexcept: m_shared(std::make_shared<Shared>(shared)) {}
+// Staged bytes belong to the instance that wrote them
+Producer::Producer(const Producer& other): m_shared(other.m_shared), m_coalesce(other.m_coalesce) {}
+
+Producer::~Producer() noexcept {
+	Abandon();
+}
+
+Producer& Producer::operator=(const Producer& other) {
+	if (this != &other) {
+		Abandon();
+		m_shared = other.m_shared;
+		m_coalesce = other.m_coalesce;
+	}
+	return *this;
+}
 
-Producer::Producer(Shared&& shared) noexcept: m_shared(std::make_shared<Shared>(std::move(shared))) {}
+Producer& Producer::operator=(Producer&& other) noexcept {
+	if (this != &other) {
+		Abandon();
+		m_shared = std::move(other.m_shared);
+		m_staging = std::move(other.m_staging);
+		m_coalesce = other.m_coalesce;
+	}
+	return *this;
+}
 
 // Sets the buffer status
 Producer& Producer::operator<<(const Status& status) {
+	Flush();
 	*m_shared << status;
 	return *this;
 }
 
 // Appends a buffer to the current buffer
 Producer& Producer::operator<<(const Simple& buffer) {
-	*m_shared << buffer;
+	Write(buffer);
 	return *this;
 }
 
 // Moves a buffer and appends it to the current buffer
 Producer& Producer::operator<<(Simple&& buffer) {
-	*m_shared << std::move(buffer);
+	Write(std::move(buffer));
 	return *this;
 }
 
 // Appends a string to the current shared buffer
 Producer& Producer::operator<<(const std::string& data) {
-	*m_shared << data;
+	Write(data);
 	return *this;
 }
 
 // Appends a byte vector to the current shared buffer
 Producer& Producer::operator<<(const Buffers::Data& data) {
-	*m_shared << data;
+	Write(data);
 	return *this;
 }
 
 // Moves a byte vector and appends it to the current shared buffer
 Producer& Producer::operator<<(Buffers::Data&& data) {
-	*m_shared << std::move(data);
+	Write(std::move(data));
 	return *this;
 }
 
+// Stages small writes to publish them with a single lock
+void Producer::Coalesce(const std::size_t& threshold) {
+	m_coalesce = threshold;
+	if (threshold == 0 || m_staging.size() >= threshold) {
+		Flush();
+	}
+}
+
 // Gets the consumer interface to consume this buffer
 Consumer Producer::Consumer() const {
 	return Buffers::Consumer(m_shared);
 }
 
+// Publishes the staged bytes in a single write
+Write::Status Producer::Flush() {
+	if (m_staging.empty()) {
+		return Write::Status::Success;
+	}
+	const auto status = m_shared->Write(ConstByteSpan(m_staging.data(), m_staging.size()));
+	// Kept capacity makes the next batch free of allocations
+	m_staging.clear();
+	return status;
+}
+
+// Bounds the unread bytes of the shared buffer
+void Producer::Limit(const std::size_t& high_water, const std::size_t& low_water) noexcept {
+	m_shared->Limit(high_water, low_water);
+}
+
 // Locks the shared buffer for exclusive access
 void Producer::Lock() {
+	Flush();
 	m_shared->Lock();
 }
 
+// Reads from a file descriptor and appends the data to the shared buffer
+StormByte::Expected<std::size_t, BufferIOError> Producer::ReadFrom(const int& fd, const std::size_t& max) {
+	Flush();
+	return m_shared->ReadFrom(fd, max);
+}
+
 // Reserves shared buffer size
 void Producer::Reserve(const std::size_t& size) {
 	m_shared->Reserve(size);
 }
 
+// Retrieves the shared buffer counters
+Shared::Statistics Producer::Stats() const noexcept {
+	return m_shared->Stats();
+}
+
+// Gets a consumer with its own read position over the written stream
+Consumer Producer::Subscribe() {
+	return Buffers::Consumer(m_shared->Subscribe());
+}
+
+// Locks the buffer for a sequence of writes taking the lock only once
+SharedTransaction Producer::Transaction() {
+	Flush();
+	return m_shared->Transaction();
+}
+
 // Unlocks the shared buffer, releasing exclusive access
 void Producer::Unlock() {
 	m_shared->Unlock();
@@ -68,26 +148,104 @@ void Producer::Unlock() {
 
 // Writes a simple buffer to the current shared buffer
 Write::Status Producer::Write(const Simple& buffer) {
+	if (buffer.Size() < m_coalesce) {
+		// Data() locks when the buffer is itself shared
+		const auto data = buffer.Data();
+		return Stage(ConstByteSpan(data.data(), data.size()));
+	}
+	Flush();
 	return m_shared->Write(buffer);
 }
 
 // Moves a simple buffer and writes it to the current shared buffer
 Write::Status Producer::Write(Simple&& buffer) {
+	if (buffer.Size() < m_coalesce) {
+		return Write(static_cast<const Simple&>(buffer));
+	}
+	Flush();
 	return m_shared->Write(std::move(buffer));
 }
 
 // Writes a string to the current shared buffer
 Write::Status Producer::Write(const std::string& data) {
-	return m_shared->Write(data);
+	return Stage(ConstByteSpan(reinterpret_cast<const Byte*>(data.data()), data.size()));
 }
 
 // Writes a byte vector to the current shared buffer
 Write::Status Producer::Write(const Buffers::Data& data) {
-	return m_shared->Write(data);
+	return Stage(ConstByteSpan(data.data(), data.size()));
 }
 
 // Moves a byte vector and writes it to the current shared buffer
 Write::Status Producer::Write(Buffers::Data&& data) {
+	if (data.size() < m_coalesce) {
+		return Stage(ConstByteSpan(data.data(), data.size()));
+	}
+	Flush();
 	return m_shared->Write(std::move(data));
 }
 
+// Writes a span of bytes to the current shared buffer
+Write::Status Producer::Write(const ConstByteSpan& data) {
+	return Stage(data);
+}
+
+// Writes a span of bytes, waiting a limited time for room
+Write::Status Producer::Write(const ConstByteSpan& data, const std::chrono::steady_clock::duration& timeout) {
+	if (m_staging.empty()) {
+		return m_shared->Write(data, timeout);
+	}
+	// Staged bytes go first and under the same time limit, they stay staged if they do not fit
+	const auto deadline = std::chrono::steady_clock::now() + timeout;
+	const auto status = m_shared->Write(ConstByteSpan(m_staging.data(), m_staging.size()), timeout);
+	if (status != Write::Status::Success) {
+		return status;
+	}
+	m_staging.clear();
+	// Only what is left of the time limit, so the whole call never waits longer than asked
+	return m_shared->Write(data, std::max(deadline - std::chrono::steady_clock::now(), std::chrono::steady_clock::duration::zero()));
+}
+
+// Writes a byte vector without blocking the thread
+Async::Awaitable<Write::Status> Producer::WriteAsync(Buffers::Data data) {
+	if (!m_staging.empty()) {
+		// Staged bytes travel with the write so they keep their order
+		m_staging.insert(m_staging.end(), data.begin(), data.end());
+		data = Buffers::Data(std::move(m_staging));
+	}
+	return Async::Awaitable<Write::Status>(m_shared, [shared = m_shared, data = std::move(data)]() -> std::optional<Write::Status> {
+		// A full buffer waits for a reader to make room, retries are not counted as blocked writes
+		const auto status = shared->TryWrite(ConstByteSpan(data.data(), data.size()));
+		if (status == Write::Status::Timeout) {
+			return std::nullopt;
+		}
+		return status;
+	});
+}
+
+Write::Status Producer::Stage(const ConstByteSpan& data) {
+	if (data.size() >= m_coalesce) {
+		Flush();
+		return m_shared->Write(data);
+	}
+	// Fail like a direct write would instead of staging bytes that can never be published
+	if (!m_shared->IsWritable()) {
+		return Write::Status::Error;
+	}
+	m_staging.insert(m_staging.end(), data.begin(), data.end());
+	return m_staging.size() >= m_coalesce ? Flush() : Write::Status::Success;
+}
+
+// Publishes the staged bytes only if that needs no waiting
+void Producer::Abandon() noexcept {
+	if (!m_shared || m_staging.empty()) {
+		return;
+	}
+	try {
+		m_shared->TryWrite(ConstByteSpan(m_staging.data(), m_staging.size()));
+	}
+	catch (...) {
+		// Nothing can be reported from here: the staged bytes are dropped
+	}
+	m_staging.clear();
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <StormByte/buffers/async.hxx>
 #include <StormByte/buffers/shared.hxx>
 #include <memory>
 
@@ -36,6 +37,8 @@ namespace StormByte::Buffers {
      * - **Shared Buffer Behavior**: While the class is designed to have only one producer and one consumer instance,
      *   if `Producer` instances are copied, they will share the same buffer. This is allowed, but it is up to the user
      *   to ensure that the produced-consumed data flow remains in sync.
+     * - **Write Combining**: @see Coalesce makes small writes collect in a staging buffer owned by each `Producer`
+     *   instance, published to the shared buffer with a single lock. Copies start with an empty staging buffer.
      */
     class STORMBYTE_PUBLIC Producer final {
         public:
@@ -47,16 +50,35 @@ namespace StormByte::Buffers {
              */
             Producer() noexcept;
 
+            /**
+             * @brief Constructor using a custom memory resource
+             *
+             * Initializes a producer whose shared buffer allocates from `resource`, so data flowing to
+             * the bound consumers is pooled as well.
+             * @param resource Memory resource to allocate from (e.g. a `Buffers::Pool`), must outlive every bound consumer.
+             */
+            explicit Producer(std::pmr::memory_resource& resource);
+
+            /**
+             * @brief Constructor using a lock-free ring
+             *
+             * Initializes a producer whose writes go through `ring` without locking while they fit in it,
+             * which suits a single writer thread feeding a single reading thread. The `Consumer` side and
+             * status handling are unchanged. @see Shared::Shared(Ring&&)
+             * @param ring Ring to use.
+             */
+            explicit Producer(Ring&& ring);
+
 			Producer(const Shared& shared) noexcept;
 
 			Producer(Shared&& shared) noexcept;
 
             /**
-             * @brief Deleted copy constructor
+             * @brief Copy constructor
              * 
-             * The `Producer` class cannot be copied to ensure data integrity and prevent unintended sharing of the buffer.
+             * The copy shares the buffer and the @see Coalesce threshold, but not the staged bytes.
              */
-            Producer(const Producer& other) 							= default;
+            Producer(const Producer& other);
 
             /**
              * @brief Default move constructor
@@ -68,26 +90,31 @@ namespace StormByte::Buffers {
             /**
              * @brief Destructor
              * 
-             * Cleans up the `Producer` instance. The destructor ensures that any resources held by the `Producer` are properly released.
+             * Cleans up the `Producer` instance, publishing any staged bytes first without waiting:
+             * they are dropped if a bounded buffer has no room for them or the write fails. Call @see Flush
+             * beforehand to wait for room instead.
              */
-            ~Producer() noexcept 										= default;
+            ~Producer() noexcept;
 
             /**
-             * @brief Deleted copy assignment operator
+             * @brief Copy assignment operator
              * 
-             * The `Producer` class cannot be copied to ensure data integrity and prevent unintended sharing of the buffer.
+             * Staged bytes are published to the current buffer before sharing the one of `other`,
+             * as the destructor does.
              */
-            Producer& operator=(const Producer& other) 					= default;
+            Producer& operator=(const Producer& other);
 
             /**
-             * @brief Default move assignment operator
+             * @brief Move assignment operator
              * 
-             * Allows moving a `Producer` instance. The moved-from instance is left in a valid but unspecified state.
+             * Staged bytes are published to the current buffer before taking over `other`, as the
+             * destructor does. The moved-from instance is left in a valid but unspecified state.
              */
-            Producer& operator=(Producer&& other) noexcept 				= default;
+            Producer& operator=(Producer&& other) noexcept;
 
 			/**
 			 * @brief Sets the buffer status
+			 * Staged bytes are flushed first, so consumers see them before the status.
 			 * @see Buffers::Status
 			 */
 			Producer& 													operator<<(const Status& status);
@@ -127,28 +154,94 @@ namespace StormByte::Buffers {
              */
             Producer& 													operator<<(Buffers::Data&& data);
 
+            /**
+             * @brief Coalesces small writes into a staging buffer owned by this producer.
+             *
+             * Writes smaller than `threshold` bytes are appended to the staging buffer instead of locking
+             * the shared buffer each, and the staged bytes are published in a single append once `threshold`
+             * bytes are staged, on @see Flush, on a status change and, if there is room, when the producer is destroyed.
+             * Larger writes flush the staged bytes and are written as usual, so the order is kept.
+             *
+             * Staged bytes are not visible to consumers and ignore the bound set by @see Limit until flushed.
+             * The staging buffer is not synchronized: with staging enabled, use this instance from one thread
+             * at a time (copies have their own staging buffer).
+             *
+             * @param threshold Staged bytes that trigger a flush, 0 to flush and stop staging.
+             */
+            void 														Coalesce(const std::size_t& threshold);
+
             /**
              * @brief Gets the consumer interface to consume this buffer.
              * 
              * Creates and returns a `Consumer` instance that is bound to this producer's shared buffer.
-             * The returned `Consumer` instance allows read-only access to the buffer.
+             * The returned `Consumer` instance allows read-only access to the buffer. Consumers share
+             * the read position, and keep receiving the whole stream once the producer broadcasts.
              * 
              * @return A `Consumer` instance bound to this producer's buffer.
              */
             Consumer 													Consumer() const;
 
+            /**
+             * @brief Publishes the bytes staged by @see Coalesce to the shared buffer in a single write.
+             * @return Write::Status of the write, `Success` if nothing was staged.
+             */
+            Write::Status 												Flush();
+
+            /**
+             * @brief Bounds the unread bytes of the shared buffer, making writes wait for consumers.
+             * @param high_water Unread bytes at which writes wait, 0 to remove the bound.
+             * @param low_water Unread bytes at which waiting writes resume.
+             * @see Shared::Limit
+             */
+            void 														Limit(const std::size_t& high_water, const std::size_t& low_water = 0) noexcept;
+
             /**
              * @brief Locks the shared buffer for exclusive access.
              * Prevents other threads from reading or writing to the buffer until `Unlock()` is called.
+             * Other members can't be called while locked, use @see Transaction to work on the locked buffer.
              */
             void 														Lock();
 
+            /**
+             * @brief Reads from a file descriptor and appends the data to the shared buffer.
+             * @param fd File descriptor to read from.
+             * @param max Maximum number of bytes to read.
+             * @return Number of bytes read (0 at end of file), or a `BufferIOError` on failure.
+             * @see Shared::ReadFrom
+             */
+            Expected<std::size_t, BufferIOError> 						ReadFrom(const int& fd, const std::size_t& max);
+
             /**
              * @brief Reserves shared buffer size.
              * @param size The size to reserve.
              */
             void 														Reserve(const std::size_t& size);
 
+            /**
+             * @brief Retrieves a snapshot of the shared buffer counters.
+             * @return Current statistics.
+             * @see Shared::Stats
+             */
+            Shared::Statistics 											Stats() const noexcept;
+
+            /**
+             * @brief Gets a consumer with its own read position, turning the producer into a broadcast.
+             *
+             * Every subscriber receives the whole stream written after it subscribed, reads it at its own
+             * pace and can extract it without affecting the others, as do the consumers from @see Consumer.
+             * Chunks are kept once for all of them and freed once every reader passed them.
+             * @return A `Consumer` instance with its own read position.
+             * @see Shared::Subscribe
+             */
+            Buffers::Consumer 											Subscribe();
+
+            /**
+             * @brief Locks the buffer for a sequence of writes taking the lock only once.
+             * @return Transaction giving access to the locked buffer.
+             * @see Shared::Transaction
+             */
+            SharedTransaction 											Transaction();
+
             /**
              * @brief Unlocks the shared buffer, releasing exclusive access.
              * Allows other threads to access the buffer after it has been locked using `Lock()`.
@@ -185,12 +278,81 @@ namespace StormByte::Buffers {
 
             /**
              * @brief Moves a byte vector and writes it to the current shared buffer.
+             * While the consumer keeps up the vector itself is handed over, see @see Shared::Write.
              * @param data The byte vector to write.
              * @return Write::Status of the operation.
              */
             Write::Status 												Write(Buffers::Data&& data);
 
+            /**
+             * @brief Writes a span of bytes to the current shared buffer.
+             * @param data The bytes to write.
+             * @return Write::Status of the operation.
+             */
+            Write::Status 												Write(const ConstByteSpan& data);
+
+            /**
+             * @brief Writes a span of bytes, waiting at most `timeout` for a bounded buffer to drain.
+             * Staged bytes are written first, within the same `timeout`.
+             * @param data The bytes to write.
+             * @param timeout Longest time to wait for room, zero to only try.
+             * @return Write::Status of the operation, `Write::Status::Timeout` if nothing was written in time.
+             * @see Shared::Write(const ConstByteSpan&, const std::chrono::steady_clock::duration&)
+             */
+            Write::Status 												Write(const ConstByteSpan& data, const std::chrono::steady_clock::duration& timeout);
+
+            /**
+             * @brief Writes a byte vector, suspending the awaiting coroutine instead of its thread while a bounded buffer is full.
+             * Staged bytes are sent along first, see @see Coalesce.
+             * @param data The byte vector to write.
+             * @return Awaitable giving the Write::Status of the operation.
+             * @see Async::Awaitable
+             */
+            Async::Awaitable<Write::Status> 							WriteAsync(Buffers::Data data);
+
+            /**
+             * @brief Encodes a numeric value with an explicit byte order and writes it.
+             * @tparam T Arithmetic or enumeration type of 1, 2, 4 or 8 bytes.
+             * @param value The value to write.
+             * @param endian Byte order to store the value with.
+             * @return Write::Status of the operation.
+             */
+            template<Binary::Numeric T>
+            Write::Status 												WriteAs(const T& value, const std::endian& endian = std::endian::native) {
+                Byte bytes[sizeof(T)];
+                Binary::Store(value, endian, bytes);
+                return Write(ConstByteSpan(bytes, sizeof(T)));
+            }
+
+            /**
+             * @brief Encodes an integer as a LEB128 varint and writes it.
+             * @tparam T Integral type to encode.
+             * @param value The value to write.
+             * @return Write::Status of the operation.
+             */
+            template<std::integral T>
+            Write::Status 												WriteVarint(const T& value) {
+                Byte bytes[Binary::MaxVarintSize];
+                const auto bits = static_cast<std::uint64_t>(static_cast<std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>(value));
+                return Write(ConstByteSpan(bytes, Binary::EncodeVarint(bits, std::is_signed_v<T>, bytes)));
+            }
+
         private:
             std::shared_ptr<Shared> m_shared; ///< The shared buffer instance.
+            Buffers::Data m_staging; ///< Small writes waiting to be published, see @see Coalesce.
+            std::size_t m_coalesce; ///< Staged bytes that trigger a flush, 0 if writes are not staged.
+
+            /**
+             * @brief Stages a write if it is small enough, otherwise writes it after flushing the staged bytes.
+             * @param data Bytes to write.
+             * @return Write::Status of the operation.
+             */
+            Write::Status 												Stage(const ConstByteSpan& data);
+
+            /**
+             * @brief Publishes the staged bytes without waiting, for an instance letting go of its buffer.
+             * They are dropped if there is no room for them right now or the write fails.
+             */
+            void 														Abandon() noexcept;
     };
 }
\ No newline at end of file
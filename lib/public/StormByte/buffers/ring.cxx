@@ -0,0 +1,80 @@
+#include <StormByte/buffers/ring.hxx>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+using namespace StormByte::Buffers;
+
+Ring::Ring(const std::size_t& capacity):
+m_storage(std::make_unique<Byte[]>(std::bit_ceil(std::max<std::size_t>(capacity, 1)))),
+m_mask(std::bit_ceil(std::max<std::size_t>(capacity, 1)) - 1), m_head(0), m_cached_tail(0), m_tail(0) {}
+
+Ring::Ring(Ring&& other) noexcept:
+m_storage(std::move(other.m_storage)), m_mask(other.m_mask), m_head(other.m_head.load()),
+m_cached_tail(other.m_cached_tail), m_tail(other.m_tail.load()) {}
+
+Ring& Ring::operator=(Ring&& other) noexcept {
+	if (this != &other) {
+		m_storage = std::move(other.m_storage);
+		m_mask = other.m_mask;
+		m_head.store(other.m_head.load());
+		m_cached_tail = other.m_cached_tail;
+		m_tail.store(other.m_tail.load());
+	}
+	return *this;
+}
+
+std::size_t Ring::Capacity() const noexcept {
+	return m_mask + 1;
+}
+
+void Ring::Consume(const std::size_t& length) noexcept {
+	m_tail.store(m_tail.load(std::memory_order_relaxed) + length, std::memory_order_release);
+}
+
+bool Ring::Empty() const noexcept {
+	return Size() == 0;
+}
+
+std::size_t Ring::Pop(const ByteSpan& output) noexcept {
+	const auto [first, second] = Readable();
+	const std::size_t from_first = std::min(first.size(), output.size());
+	const std::size_t from_second = std::min(second.size(), output.size() - from_first);
+	std::memcpy(output.data(), first.data(), from_first);
+	std::memcpy(output.data() + from_first, second.data(), from_second);
+	Consume(from_first + from_second);
+	return from_first + from_second;
+}
+
+bool Ring::Push(const ConstByteSpan& data) noexcept {
+	const std::size_t head = m_head.load(std::memory_order_relaxed);
+	if (Capacity() - (head - m_cached_tail) < data.size()) {
+		m_cached_tail = m_tail.load(std::memory_order_acquire);
+		if (Capacity() - (head - m_cached_tail) < data.size()) {
+			return false;
+		}
+	}
+	const std::size_t offset = head & m_mask;
+	const std::size_t first = std::min(data.size(), Capacity() - offset);
+	std::memcpy(m_storage.get() + offset, data.data(), first);
+	std::memcpy(m_storage.get(), data.data() + first, data.size() - first);
+	m_head.store(head + data.size(), std::memory_order_release);
+	return true;
+}
+
+std::array<ConstByteSpan, 2> Ring::Readable() const noexcept {
+	const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+	const std::size_t stored = m_head.load(std::memory_order_acquire) - tail;
+	const std::size_t offset = tail & m_mask;
+	const std::size_t first = std::min(stored, Capacity() - offset);
+	return {
+		ConstByteSpan(m_storage.get() + offset, first),
+		ConstByteSpan(m_storage.get(), stored - first)
+	};
+}
+
+std::size_t Ring::Size() const noexcept {
+	const std::size_t tail = m_tail.load(std::memory_order_acquire);
+	return m_head.load(std::memory_order_acquire) - tail;
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers {
+	/**
+	 * @class Ring
+	 * @brief A bounded lock-free single producer, single consumer byte ring.
+	 *
+	 * One thread pushes while another one reads and consumes, synchronized only through the acquire/release
+	 * write and read indices, which live on separate cache lines. Pushes are all or nothing: a write that does
+	 * not fit is refused so the caller can decide whether to wait or take another path.
+	 *
+	 * **Usage:**
+	 * - Pass it to `Shared` or `Producer` constructors to back a single producer/consumer pair: writes that fit
+	 *   go through the ring without taking a lock, and the consumer side moves them into the buffer as it reads.
+	 * - Use it directly for a raw byte channel between exactly two threads.
+	 *
+	 * Moving a ring is only safe while no other thread uses it.
+	 */
+	class STORMBYTE_PUBLIC Ring final {
+		public:
+			static constexpr std::size_t DefaultCapacity	= 256 * 1024;			///< Capacity used when none is given.
+
+			/**
+			 * @brief Constructor
+			 * @param capacity Minimum number of bytes the ring holds, rounded up to a power of two.
+			 */
+			explicit Ring(const std::size_t& capacity = DefaultCapacity);
+
+			/**
+			 * @brief Deleted copy constructor
+			 */
+			Ring(const Ring& other)													= delete;
+
+			/**
+			 * @brief Move constructor
+			 * @param other Ring to move, must not be in use by other threads.
+			 */
+			Ring(Ring&& other) noexcept;
+
+			/**
+			 * @brief Destructor
+			 */
+			~Ring() noexcept 														= default;
+
+			/**
+			 * @brief Deleted copy assignment operator
+			 */
+			Ring& operator=(const Ring& other)										= delete;
+
+			/**
+			 * @brief Move assignment operator
+			 * @param other Ring to move, must not be in use by other threads.
+			 * @return Reference to this ring.
+			 */
+			Ring& operator=(Ring&& other) noexcept;
+
+			/**
+			 * @brief Retrieves the number of bytes the ring can hold
+			 * @return Capacity in bytes.
+			 */
+			std::size_t 															Capacity() const noexcept;
+
+			/**
+			 * @brief Marks bytes returned by @see Readable as read, making room for the producer (consumer side)
+			 * @param length Number of bytes to release, at most the size of the last `Readable` spans.
+			 */
+			void 																	Consume(const std::size_t& length) noexcept;
+
+			/**
+			 * @brief Checks if the ring holds no bytes
+			 * @return True if the ring is empty.
+			 */
+			bool 																	Empty() const noexcept;
+
+			/**
+			 * @brief Copies and consumes up to `output.size()` bytes (consumer side)
+			 * @param output Destination of the bytes.
+			 * @return Number of bytes copied.
+			 */
+			std::size_t 															Pop(const ByteSpan& output) noexcept;
+
+			/**
+			 * @brief Copies bytes into the ring if they fit entirely (producer side)
+			 * @param data Bytes to copy.
+			 * @return True if the bytes were stored, false if there is not enough free space.
+			 */
+			bool 																	Push(const ConstByteSpan& data) noexcept;
+
+			/**
+			 * @brief Retrieves the stored bytes without consuming them (consumer side)
+			 *
+			 * The bytes are returned as two spans since they may wrap around the end of the storage;
+			 * the second one is empty when they do not.
+			 *
+			 * @return The stored bytes in order.
+			 */
+			std::array<ConstByteSpan, 2> 											Readable() const noexcept;
+
+			/**
+			 * @brief Retrieves the number of stored bytes
+			 * @return Stored bytes; exact only when called from the producer or consumer thread.
+			 */
+			std::size_t 															Size() const noexcept;
+
+		private:
+			static constexpr std::size_t CacheLine = 64;							///< Assumed cache line size, keeps producer and consumer state apart.
+
+			std::unique_ptr<Byte[]> m_storage;										///< Ring storage.
+			std::size_t m_mask;														///< Capacity minus one.
+			alignas(CacheLine) std::atomic<std::size_t> m_head;						///< Total bytes pushed, written by the producer.
+			std::size_t m_cached_tail;												///< Producer's last seen `m_tail`, saves reloading it on every push.
+			alignas(CacheLine) std::atomic<std::size_t> m_tail;						///< Total bytes consumed, written by the consumer.
+	};
+}
\ No newline at end of file
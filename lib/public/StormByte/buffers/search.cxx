@@ -0,0 +1,91 @@
+#include <StormByte/buffers/search.hxx>
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STORMBYTE_SEARCH_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+using namespace StormByte::Buffers;
+
+namespace {
+	bool Matches(const Byte* candidate, const ConstByteSpan& pattern) noexcept {
+		// First and last bytes already matched
+		return std::memcmp(candidate + 1, pattern.data() + 1, pattern.size() - 2) == 0;
+	}
+
+	#ifdef STORMBYTE_SEARCH_SSE2
+	int LowestBit(const unsigned int& mask) noexcept {
+		#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return static_cast<int>(index);
+		#else
+		return __builtin_ctz(mask);
+		#endif
+	}
+	#endif
+}
+
+std::optional<std::size_t> Search::Find(const ConstByteSpan& data, const Byte& value) noexcept {
+	if (data.empty()) {
+		return std::nullopt;
+	}
+	const void* found = std::memchr(data.data(), static_cast<int>(value), data.size());
+	if (found == nullptr) {
+		return std::nullopt;
+	}
+	return static_cast<std::size_t>(static_cast<const Byte*>(found) - data.data());
+}
+
+std::optional<std::size_t> Search::Find(const ConstByteSpan& data, const ConstByteSpan& pattern) noexcept {
+	if (pattern.empty()) {
+		return 0;
+	}
+	if (pattern.size() == 1) {
+		return Find(data, pattern[0]);
+	}
+	if (pattern.size() > data.size()) {
+		return std::nullopt;
+	}
+
+	const std::size_t last = pattern.size() - 1;
+	const std::size_t candidates = data.size() - last; // Offsets where the pattern still fits
+	std::size_t offset = 0;
+
+	#ifdef STORMBYTE_SEARCH_SSE2
+	const __m128i first_byte = _mm_set1_epi8(static_cast<char>(pattern[0]));
+	const __m128i last_byte = _mm_set1_epi8(static_cast<char>(pattern[last]));
+	for (; offset + 16 <= candidates; offset += 16) {
+		const __m128i starts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + offset));
+		const __m128i ends = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + offset + last));
+		auto mask = static_cast<unsigned int>(_mm_movemask_epi8(
+			_mm_and_si128(_mm_cmpeq_epi8(starts, first_byte), _mm_cmpeq_epi8(ends, last_byte))
+		));
+		while (mask != 0) {
+			const std::size_t candidate = offset + static_cast<std::size_t>(LowestBit(mask));
+			if (Matches(data.data() + candidate, pattern)) {
+				return candidate;
+			}
+			mask &= mask - 1;
+		}
+	}
+	#endif
+
+	while (offset < candidates) {
+		const auto found = Find(data.subspan(offset, candidates - offset), pattern[0]);
+		if (!found) {
+			return std::nullopt;
+		}
+		const std::size_t candidate = offset + *found;
+		if (data[candidate + last] == pattern[last] && Matches(data.data() + candidate, pattern)) {
+			return candidate;
+		}
+		offset = candidate + 1;
+	}
+	return std::nullopt;
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+#include <optional>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers::Search {
+	/**
+	 * @brief Finds the first occurrence of a byte.
+	 *
+	 * Backed by `memchr`, which the C library vectorizes.
+	 *
+	 * @param data Bytes to search.
+	 * @param value Byte to find.
+	 * @return Offset of the byte in `data`, or `std::nullopt` if it does not occur.
+	 */
+	STORMBYTE_PUBLIC std::optional<std::size_t> 							Find(const ConstByteSpan& data, const Byte& value) noexcept;
+
+	/**
+	 * @brief Finds the first occurrence of a byte sequence.
+	 *
+	 * Candidates are filtered 16 positions at a time by comparing the first and last bytes of the
+	 * pattern with SSE2 (a `memchr` driven scan elsewhere), and only matching candidates are compared in full.
+	 *
+	 * @param data Bytes to search.
+	 * @param pattern Sequence to find; an empty pattern matches at offset 0.
+	 * @return Offset of the sequence in `data`, or `std::nullopt` if it does not occur.
+	 */
+	STORMBYTE_PUBLIC std::optional<std::size_t> 							Find(const ConstByteSpan& data, const ConstByteSpan& pattern) noexcept;
+}
\ No newline at end of file
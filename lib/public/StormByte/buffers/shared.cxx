@@ -1,50 +1,185 @@
+#include <StormByte/buffers/hexdump.hxx>
+#include <StormByte/buffers/io.hxx>
+#include <StormByte/buffers/search.hxx>
 #include <StormByte/buffers/shared.hxx>
 
 #include <algorithm>
+#include <deque>
 #include <thread>
+#include <utility>
+#include <vector>
 
 using namespace StormByte::Buffers;
 
-Shared::Shared() noexcept: Simple(), m_status(Status::Ready) {}
+// Chunks written to a broadcast, read by the broadcasting buffer and its subscribers through their own stream position
+struct Shared::Stream {
+	struct Chunk {
+		std::uint64_t offset;									// Stream offset of the first byte
+		Simple bytes;
+	};
+	std::mutex mutex;											// Guards every member but `end`, and the readers' stream positions
+	std::deque<Chunk> chunks;									// Chunks some reader did not pass yet, by offset
+	std::atomic<std::uint64_t> end { 0 };						// Stream offset past the last chunk
+	Shared* source = nullptr;									// Broadcasting buffer, null once destroyed
+	std::vector<std::weak_ptr<Shared>> subscribers;
+};
 
-Shared::Shared(const std::size_t& size): Simple(size), m_status(Status::Ready) {}
+SharedView::SharedView(SharedView&& other) noexcept:
+m_lock(std::move(other.m_lock)), m_span(other.m_span), m_consumed(std::exchange(other.m_consumed, nullptr)) {}
 
-Shared::Shared(const char* data, const std::size_t& length): Simple(data, length), m_status(Status::Ready) {}
+SharedView::~SharedView() noexcept {
+	Release();
+}
+
+SharedView& SharedView::operator=(SharedView&& other) noexcept {
+	if (this != &other) {
+		Release();
+		m_lock = std::move(other.m_lock);
+		m_span = other.m_span;
+		m_consumed = std::exchange(other.m_consumed, nullptr);
+	}
+	return *this;
+}
+
+void SharedView::Release() noexcept {
+	if (m_lock.owns_lock()) {
+		m_lock.unlock();
+	}
+	// Woken writers may take the lock at once, even from this thread
+	if (const auto* consumed = std::exchange(m_consumed, nullptr)) {
+		consumed->Released();
+	}
+}
+
+SharedTransaction::SharedTransaction(Shared& buffer, std::unique_lock<Metrics::SharedMutex>&& lock) noexcept:
+m_buffer(&buffer), m_lock(std::move(lock)), m_appended(buffer.m_appended), m_contents(std::move(static_cast<Simple&>(buffer))) {}
+
+SharedTransaction::SharedTransaction(SharedTransaction&& other) noexcept:
+m_buffer(std::exchange(other.m_buffer, nullptr)), m_lock(std::move(other.m_lock)), m_appended(other.m_appended), m_contents(std::move(other.m_contents)) {}
+
+SharedTransaction::~SharedTransaction() noexcept {
+	if (m_buffer) {
+		static_cast<Simple&>(*m_buffer) = std::move(m_contents);
+		bool broadcast = false;
+		if (m_buffer->m_broadcast.load(std::memory_order_relaxed)) {
+			// The appended bytes are the last ones held, unless the transaction removed some of them again
+			const std::size_t size = m_buffer->Simple::Size();
+			const std::size_t appended = std::min(m_buffer->m_appended - m_appended, size);
+			if (appended > 0) {
+				m_buffer->Emit(std::move(*m_buffer->Simple::Slice(size - appended, appended)), true);
+				broadcast = true;
+			}
+		}
+		m_buffer->Publish();
+		m_lock.unlock();
+		// Both data and room may have changed: wake readers and writers alike
+		m_buffer->Notify();
+		if (broadcast) {
+			for (const auto& subscriber: m_buffer->Subscribers()) {
+				subscriber->Notify();
+			}
+		}
+	}
+}
+
+Shared::Shared() noexcept: Simple(), m_status(Status::Ready), m_generation(0), m_sleepers(false), m_cursor(m_position), m_end(Simple::Size()), m_ring(nullptr), m_high_water(0), m_low_water(0), m_blocked_writes(0), m_write_timeouts(0), m_blocked_nanoseconds(0), m_broadcast(false), m_stream(nullptr), m_feed(nullptr), m_stream_position(0), m_stream_cursor(0), m_consumers(0) {}
+
+Shared::Shared(std::pmr::memory_resource& resource) noexcept: Simple(resource), m_status(Status::Ready), m_generation(0), m_sleepers(false), m_cursor(m_position), m_end(Simple::Size()), m_ring(nullptr), m_high_water(0), m_low_water(0), m_blocked_writes(0), m_write_timeouts(0), m_blocked_nanoseconds(0), m_broadcast(false), m_stream(nullptr), m_feed(nullptr), m_stream_position(0), m_stream_cursor(0), m_consumers(0) {}
+
+Shared::Shared(const std::size_t& size): Simple(size), m_status(Status::Ready), m_generation(0), m_sleepers(false), m_cursor(m_position), m_end(Simple::Size()), m_ring(nullptr), m_high_water(0), m_low_water(0), m_blocked_writes(0), m_write_timeouts(0), m_blocked_nanoseconds(0), m_broadcast(false), m_stream(nullptr), m_feed(nullptr), m_stream_position(0), m_stream_cursor(0), m_consumers(0) {}
 
-Shared::Shared(const std::string& data): Simple(data), m_status(Status::Ready) {}
+Shared::Shared(const char* data, const std::size_t& length): Simple(data, length), m_status(Status::Ready), m_generation(0), m_sleepers(false), m_cursor(m_position), m_end(Simple::Size()), m_ring(nullptr), m_high_water(0), m_low_water(0), m_blocked_writes(0), m_write_timeouts(0), m_blocked_nanoseconds(0), m_broadcast(false), m_stream(nullptr), m_feed(nullptr), m_stream_position(0), m_stream_cursor(0), m_consumers(0) {}
 
-Shared::Shared(const Buffers::Data& data): Simple(data), m_status(Status::Ready) {}
+Shared::Shared(const std::string& data): Simple(data), m_status(Status::Ready), m_generation(0), m_sleepers(false), m_cursor(m_position), m_end(Simple::Size()), m_ring(nullptr), m_high_water(0), m_low_water(0), m_blocked_writes(0), m_write_timeouts(0), m_blocked_nanoseconds(0), m_broadcast(false), m_stream(nullptr), m_feed(nullptr), m_stream_position(0), m_stream_cursor(0), m_consumers(0) {}
 
-Shared::Shared(Buffers::Data&& data): Simple(std::move(data)), m_status(Status::Ready) {}
+Shared::Shared(const Buffers::Data& data): Simple(data), m_status(Status::Ready), m_generation(0), m_sleepers(false), m_cursor(m_position), m_end(Simple::Size()), m_ring(nullptr), m_high_water(0), m_low_water(0), m_blocked_writes(0), m_write_timeouts(0), m_blocked_nanoseconds(0), m_broadcast(false), m_stream(nullptr), m_feed(nullptr), m_stream_position(0), m_stream_cursor(0), m_consumers(0) {}
 
-Shared::Shared(const std::span<const Byte>& data): Simple(data), m_status(Status::Ready) {}
+Shared::Shared(Buffers::Data&& data): Simple(std::move(data)), m_status(Status::Ready), m_generation(0), m_sleepers(false), m_cursor(m_position), m_end(Simple::Size()), m_ring(nullptr), m_high_water(0), m_low_water(0), m_blocked_writes(0), m_write_timeouts(0), m_blocked_nanoseconds(0), m_broadcast(false), m_stream(nullptr), m_feed(nullptr), m_stream_position(0), m_stream_cursor(0), m_consumers(0) {}
 
-Shared::Shared(const Shared& other): Simple(other), m_status(other.m_status.load()) {}
+Shared::Shared(const std::span<const Byte>& data): Simple(data), m_status(Status::Ready), m_generation(0), m_sleepers(false), m_cursor(m_position), m_end(Simple::Size()), m_ring(nullptr), m_high_water(0), m_low_water(0), m_blocked_writes(0), m_write_timeouts(0), m_blocked_nanoseconds(0), m_broadcast(false), m_stream(nullptr), m_feed(nullptr), m_stream_position(0), m_stream_cursor(0), m_consumers(0) {}
 
-Shared::Shared(Shared&& other) noexcept: Simple(std::move(other)), m_status(other.m_status.load()) {}
+Shared::Shared(Ring&& ring): Simple(), m_status(Status::Ready), m_generation(0), m_sleepers(false), m_cursor(m_position), m_end(Simple::Size()), m_ring(std::make_unique<Ring>(std::move(ring))), m_high_water(0), m_low_water(0), m_blocked_writes(0), m_write_timeouts(0), m_blocked_nanoseconds(0), m_broadcast(false), m_stream(nullptr), m_feed(nullptr), m_stream_position(0), m_stream_cursor(0), m_consumers(0) {}
+
+Shared::Shared(const Shared& other): Simple([&other] {
+	// Copying only shares the storage, but it must not race with a writer
+	std::unique_lock lock(other.m_data_mutex);
+	auto& source = const_cast<Shared&>(other);
+	source.Acquire();
+	source.Publish();
+	return Simple(other);
+}()), m_status(other.m_status.load()), m_generation(0), m_sleepers(false), m_cursor(m_position), m_end(Simple::Size()), m_ring(nullptr),
+m_high_water(other.m_high_water.load()), m_low_water(other.m_low_water.load()), m_blocked_writes(0), m_write_timeouts(0), m_blocked_nanoseconds(0), m_broadcast(false), m_stream(nullptr), m_feed(nullptr), m_stream_position(0), m_stream_cursor(0), m_consumers(0) {}
+
+Shared::Shared(Shared&& other): Simple([&other] {
+	other.Acquire();
+	Simple contents(std::move(other));
+	other.Publish();
+	return contents;
+}()), m_status(other.m_status.load()), m_generation(0), m_sleepers(false), m_cursor(m_position), m_end(Simple::Size()), m_ring(std::move(other.m_ring)),
+m_high_water(other.m_high_water.load()), m_low_water(other.m_low_water.load()), m_blocked_writes(0), m_write_timeouts(0), m_blocked_nanoseconds(0),
+m_broadcast(other.m_broadcast.load()), m_stream(m_broadcast.load() ? std::move(other.m_stream) : nullptr), m_feed(m_stream.get()),
+m_stream_position(m_stream ? other.m_stream_position : 0), m_stream_cursor(m_stream_position), m_consumers(0) {
+	if (m_broadcast.load()) {
+		// Subscribers keep receiving what this buffer writes; the stream no longer waits for `other`
+		std::lock_guard lock(m_stream->mutex);
+		m_stream->source = this;
+		other.m_feed.store(nullptr);
+		other.m_broadcast.store(false);
+	}
+}
+
+Shared::~Shared() noexcept {
+	if (m_broadcast.load()) {
+		// Subscribers keep reading the chunks, this buffer no longer holds them back
+		std::lock_guard lock(m_stream->mutex);
+		m_stream->source = nullptr;
+	}
+}
 
 Shared& Shared::operator=(const Shared& other) {
 	if (this != &other) {
 		std::unique_lock lock(m_data_mutex);
 		std::unique_lock other_lock(other.m_data_mutex);
+		auto& source = const_cast<Shared&>(other);
+		Acquire();
+		source.Acquire();
 		Simple::operator=(other);
 		m_status.store(other.m_status.load());
+		Publish();
+		source.Publish();
+		lock.unlock();
+		other_lock.unlock();
+		Notify();
 	}
 	return *this;
 }
 
-Shared& Shared::operator=(Shared&& other) noexcept {
+Shared& Shared::operator=(Shared&& other) {
 	if (this != &other) {
 		std::unique_lock lock(m_data_mutex);
 		std::unique_lock other_lock(other.m_data_mutex);
+		Acquire();
+		other.Acquire();
 		Simple::operator=(std::move(other));
+		m_ring = std::move(other.m_ring);
 		m_status.store(other.m_status.load());
+		Publish();
+		other.Publish();
+		lock.unlock();
+		other_lock.unlock();
+		Notify();
 	}
 	return *this;
 }
 
 Shared& Shared::operator<<(const enum Status& status) {
 	m_status.store(status);
+	Notify();
+	if (m_broadcast.load(std::memory_order_relaxed)) {
+		for (const auto& subscriber: Subscribers()) {
+			*subscriber << status;
+		}
+	}
 	return *this;
 }
 
@@ -74,15 +209,52 @@ Shared& Shared::operator<<(Buffers::Data&& data) {
 }
 
 Shared& Shared::operator>>(Shared& buffer) {
-	std::shared_lock lock(m_data_mutex);
-	std::unique_lock other_lock(buffer.m_data_mutex);
-	Simple::operator>>(buffer);
+	if (buffer.m_broadcast.load(std::memory_order_relaxed)) {
+		// Taken under this lock only, then broadcast as any other write
+		auto chunk = buffer.Chunk();
+		{
+			std::unique_lock lock(m_data_mutex);
+			Acquire();
+			m_counters.Read(Simple::AvailableBytes());
+			Simple::operator>>(chunk);
+			Publish();
+		}
+		Released();
+		buffer.Write(std::move(chunk));
+		return *this;
+	}
+	{
+		// Moves the read position, so readers holding the shared lock must be kept out
+		std::unique_lock lock(m_data_mutex);
+		std::unique_lock other_lock(buffer.m_data_mutex);
+		Acquire();
+		buffer.Acquire();
+		m_counters.Read(Simple::AvailableBytes());
+		Simple::operator>>(buffer);
+		buffer.m_counters.Written(Simple::Size());
+		buffer.m_counters.Stored(buffer.Simple::AvailableBytes());
+		Publish();
+		buffer.Publish();
+	}
+	buffer.Notify();
+	Released();
 	return *this;
 }
 
 size_t Shared::AvailableBytes() const noexcept {
-	std::shared_lock lock(m_data_mutex);
-	return Simple::AvailableBytes();
+	return Unread();
+}
+
+void Shared::Limit(const std::size_t& high_water, const std::size_t& low_water) noexcept {
+	m_high_water.store(high_water);
+	m_low_water.store(high_water == 0 ? 0 : std::min(low_water, high_water - 1));
+	// Writers blocked under the previous marks check the new ones
+	Notify();
+	if (m_broadcast.load(std::memory_order_relaxed)) {
+		for (const auto& subscriber: Subscribers()) {
+			subscriber->Limit(high_water, low_water);
+		}
+	}
 }
 
 size_t Shared::Capacity() const noexcept {
@@ -91,107 +263,182 @@ size_t Shared::Capacity() const noexcept {
 }
 
 void Shared::Clear() noexcept {
-	std::unique_lock lock(m_data_mutex);
-	Simple::Clear();
+	{
+		std::unique_lock lock(m_data_mutex);
+		// Bytes still in the ring were written before the clear
+		Acquire();
+		Simple::Clear();
+		Publish();
+	}
+	Notify();
 }
 
 Data Shared::Data() const noexcept {
+	Drain();
 	std::shared_lock lock(m_data_mutex);
 	return Simple::Data();
 }
 
-void Shared::Discard(const std::size_t& length, const Read::Position& mode) noexcept {
-	std::unique_lock lock(m_data_mutex);
-	Simple::Discard(length, mode);
+void Shared::Discard(const std::size_t& length, const Read::Position& mode) {
+	const auto flags = static_cast<unsigned short>(mode);
+	// Discarding from the start or the read position needs `length` unread bytes, not every pending one
+	const bool front = (flags & static_cast<unsigned short>(Read::Position::Begin)) ||
+		(!(flags & static_cast<unsigned short>(Read::Position::End)) && (flags & static_cast<unsigned short>(Read::Position::Relative)));
+	{
+		std::unique_lock lock(m_data_mutex);
+		Acquire(front ? length : std::numeric_limits<std::size_t>::max());
+		Simple::Discard(length, mode);
+		Publish();
+	}
+	Released();
 }
 
 bool Shared::Empty() const noexcept {
-	std::shared_lock lock(m_data_mutex);
-	return Simple::Empty();
+	return Shared::Size() == 0;
 }
 
 bool Shared::End() const noexcept {
-	std::shared_lock lock(m_data_mutex);
-	return Simple::End();
+	return Unread() == 0;
 }
 
 void Shared::Lock() {
 	m_data_mutex.lock();
+	Acquire();
 }
 
 ExpectedData<BufferOverflow> Shared::Extract(const std::size_t& length) {
-	// Wait until enough data is available or an error occurs
-	auto wait_status = Wait(length);
-	if (wait_status != Read::Status::Success) {
-		return StormByte::Unexpected<BufferOverflow>("Not enough data to extract.");
-	}
-
-	Buffers::Data extracted_data;
-
-	// Check if there is enough data to extract
-	if (!HasEnoughData(length)) {
-		return StormByte::Unexpected<BufferOverflow>("Buffer overflow during extraction.");
-	}
+	return ExtractBefore(length, std::nullopt);
+}
 
-	// Lock the data mutex for thread-safe access
-	std::unique_lock lock(m_data_mutex);
+ExpectedData<BufferOverflow> Shared::Extract(const std::size_t& length, const std::chrono::steady_clock::time_point& deadline) {
+	return ExtractBefore(length, deadline);
+}
 
-	// Move the extracted data into a new buffer
-	auto start = m_data.begin() + m_position;
-	auto end = start + length;
-	extracted_data = Buffers::Data(std::make_move_iterator(start), std::make_move_iterator(end));
+ExpectedData<BufferOverflow> Shared::Extract(const std::size_t& length, const std::chrono::steady_clock::duration& timeout) {
+	return ExtractBefore(length, std::chrono::steady_clock::now() + timeout);
+}
 
-	// Use Discard to remove the extracted data
-	Simple::Discard(length, Read::Position::Relative);
+ExpectedData<BufferOverflow> Shared::ExtractBefore(const std::size_t& length, const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+	while (true) {
+		// Wait until enough data is available, an error occurs or the deadline passes
+		auto wait_status = Wait(length, deadline);
+		if (wait_status == Read::Status::Timeout) {
+			return StormByte::Unexpected<BufferTimeout>("Timed out waiting for {} bytes to extract.", length);
+		}
+		if (wait_status != Read::Status::Success) {
+			return StormByte::Unexpected<BufferOverflow>("Not enough data to extract.");
+		}
 
-	return extracted_data;
+		if (auto data = ExtractRing(length)) {
+			m_counters.Extracted(length);
+			Released();
+			return std::move(*data);
+		}
+		std::unique_lock lock(m_data_mutex);
+		Acquire(length);
+		if (!Simple::HasEnoughData(length)) {
+			// Another reader took the data first: wait for more
+			Publish();
+			continue;
+		}
+		auto data = Simple::Extract(length);
+		Publish();
+		lock.unlock();
+		m_counters.Extracted(length);
+		Released();
+		return data;
+	}
 }
 
 Read::Status Shared::ExtractInto(const std::size_t& length, Shared& output) noexcept {
 	if (!HasEnoughData(length)) {
 		return Read::Status::Error;
 	}
+	if (output.m_broadcast.load(std::memory_order_relaxed)) {
+		// Extracted under this lock only, then broadcast as any other write
+		auto chunk = output.Chunk();
+		Read::Status status;
+		{
+			std::unique_lock lock(m_data_mutex);
+			Acquire(length);
+			status = Simple::ExtractInto(length, chunk);
+			Publish();
+		}
+		if (status == Read::Status::Success) {
+			m_counters.Extracted(length);
+			output.Write(std::move(chunk));
+		}
+		Released();
+		return status;
+	}
 
 	std::unique_lock lock(m_data_mutex);
-
-	// Lock the data to extract
-	auto start = m_data.begin() + m_position;
-	auto end = start + length;
-
 	std::unique_lock other_lock(output.m_data_mutex);
-	// Move the data directly into the output buffer
-	output.m_data.reserve(output.m_data.size() + length);
-	output.m_data.insert(output.m_data.end(),
-						std::make_move_iterator(start),
-						std::make_move_iterator(end));
+	Acquire();
+	output.Acquire();
+	const auto status = Simple::ExtractInto(length, output);
+	if (status == Read::Status::Success) {
+		output.m_counters.Stored(output.Simple::AvailableBytes());
+	}
+	Publish();
+	output.Publish();
+	other_lock.unlock();
+	lock.unlock();
+	if (status == Read::Status::Success) {
+		m_counters.Extracted(length);
+		output.m_counters.Written(length);
+	}
+	output.Notify();
+	Released();
+	return status;
+}
 
-	// Use Discard to remove the extracted data
-	Simple::Discard(length, Read::Position::Relative);
+std::optional<std::size_t> Shared::Find(const Byte& value) const {
+	Drain();
+	std::shared_lock lock(m_data_mutex);
+	return Search::Find(Simple::Span().subspan(std::min(m_cursor.load(std::memory_order_acquire), Simple::Size())), value);
+}
 
-	return Read::Status::Success;
+std::optional<std::size_t> Shared::Find(const ConstByteSpan& pattern) const {
+	Drain();
+	std::shared_lock lock(m_data_mutex);
+	return Search::Find(Simple::Span().subspan(std::min(m_cursor.load(std::memory_order_acquire), Simple::Size())), pattern);
 }
 
 bool Shared::HasEnoughData(const std::size_t& length) const {
-	std::shared_lock lock(m_data_mutex);
-	return Simple::HasEnoughData(length);
+	return Unread() >= length;
 }
 
 std::string Shared::HexData(const std::size_t& column_size) const {
-	std::shared_lock lock(m_data_mutex);
-	return Simple::HexData(column_size);
+	return HexData(0, std::numeric_limits<std::size_t>::max(), column_size);
+}
+
+std::string Shared::HexData(const std::size_t& offset, const std::size_t& length, const std::size_t& column_size) const {
+	return HexDump::Encode(Snapshot(offset, length), column_size);
+}
+
+void Shared::HexData(std::ostream& output, const std::size_t& offset, const std::size_t& length, const std::size_t& column_size) const {
+	HexDump::Encode(Snapshot(offset, length), column_size, output);
+}
+
+Write::Status Shared::HexData(Producer& output, const std::size_t& offset, const std::size_t& length, const std::size_t& column_size) const {
+	return HexDump::Encode(Snapshot(offset, length), column_size, output);
 }
 
 bool Shared::IsReadable() const noexcept {
 	return m_status.load() != Status::Error;
 }
 
+bool Shared::IsBroadcasting() const noexcept {
+	return m_broadcast.load();
+}
+
 bool Shared::IsEoF() const noexcept {
 	if (IsWritable()) {
 		return false;
 	}
 	else {
-		std::shared_lock lock(m_data_mutex);
-		return Simple::IsEoF();
+		return Unread() == 0;
 	}
 }
 
@@ -200,22 +447,123 @@ bool Shared::IsWritable() const noexcept {
 }
 
 ExpectedByte<BufferOverflow> Shared::Peek() const {
+	Drain(1);
 	std::shared_lock lock(m_data_mutex);
-	return Simple::Peek();
+	const auto position = Claim(1, false);
+	if (!position) {
+		return StormByte::Unexpected<BufferOverflow>("Cannot peek: no more data available in the buffer.");
+	}
+	return Simple::Span()[*position];
 }
 
-std::size_t Shared::Position() const noexcept {
+StormByte::Expected<SharedView, BufferOverflow> Shared::PeekView(const std::size_t& length) const {
+	auto wait_status = Wait(length);
+	if (wait_status != Read::Status::Success) {
+		return StormByte::Unexpected<BufferOverflow>("Not enough data to view.");
+	}
+	Drain(length);
 	std::shared_lock lock(m_data_mutex);
-	return Simple::Position();
+	const auto position = Claim(length, false);
+	if (!position) {
+		return StormByte::Unexpected<BufferOverflow>("Insufficient data to view {} bytes", length);
+	}
+	return SharedView(std::move(lock), Simple::Span().subspan(*position, length));
+}
+
+std::size_t Shared::Position() const noexcept {
+	return m_cursor.load(std::memory_order_acquire);
 }
 
 ExpectedData<BufferOverflow> Shared::Read(const std::size_t& length) const {
-	auto wait_status = Wait(length);
-	if (wait_status != Read::Status::Success) {
-		return StormByte::Unexpected<BufferOverflow>("Not enough data to read.");
+	return ReadBefore(length, std::nullopt);
+}
+
+ExpectedData<BufferOverflow> Shared::Read(const std::size_t& length, const std::chrono::steady_clock::time_point& deadline) const {
+	return ReadBefore(length, deadline);
+}
+
+ExpectedData<BufferOverflow> Shared::Read(const std::size_t& length, const std::chrono::steady_clock::duration& timeout) const {
+	return ReadBefore(length, std::chrono::steady_clock::now() + timeout);
+}
+
+ExpectedData<BufferOverflow> Shared::ReadBefore(const std::size_t& length, const std::optional<std::chrono::steady_clock::time_point>& deadline) const {
+	while (true) {
+		auto wait_status = Wait(length, deadline);
+		if (wait_status == Read::Status::Timeout) {
+			return StormByte::Unexpected<BufferTimeout>("Timed out waiting for {} bytes to read.", length);
+		}
+		if (wait_status != Read::Status::Success) {
+			return StormByte::Unexpected<BufferOverflow>("Not enough data to read.");
+		}
+		Drain(length);
+		std::shared_lock lock(m_data_mutex);
+		const auto position = Claim(length);
+		if (!position) {
+			// Another reader took the data first: wait for more
+			continue;
+		}
+		const auto claimed = Simple::Span().subspan(*position, length);
+		Buffers::Data data(claimed.begin(), claimed.end());
+		lock.unlock();
+		m_counters.Read(length);
+		Released();
+		return data;
+	}
+}
+
+StormByte::Expected<SharedView, BufferOverflow> Shared::ReadView(const std::size_t& length) const {
+	while (true) {
+		if (Wait(length) != Read::Status::Success) {
+			return StormByte::Unexpected<BufferOverflow>("Not enough data to view.");
+		}
+		Drain(length);
+		std::shared_lock lock(m_data_mutex);
+		const auto position = Claim(length);
+		if (!position) {
+			continue;
+		}
+		m_counters.Read(length);
+		return SharedView(std::move(lock), Simple::Span().subspan(*position, length), this);
 	}
-	std::shared_lock lock(m_data_mutex);
-	return Simple::Read(length);
+}
+
+StormByte::Expected<std::size_t, BufferIOError> Shared::ReadFrom(const int& fd, const std::size_t& max) {
+	if (m_broadcast.load(std::memory_order_relaxed)) {
+		if (!IsWritable()) {
+			return StormByte::Unexpected<BufferIOError>("Can not read from descriptor {}: buffer is not writable", fd);
+		}
+		Buffers::Data data(max);
+		const ByteSpan region(data.data(), data.size());
+		auto read = IO::Read(fd, std::span<const ByteSpan>(&region, 1));
+		if (read && *read > 0) {
+			data.resize(*read);
+			auto chunk = Chunk();
+			chunk.Write(std::move(data));
+			Broadcast(std::move(chunk), std::nullopt);
+		}
+		return read;
+	}
+	if (Admit(std::nullopt) != Write::Status::Success) {
+		return StormByte::Unexpected<BufferIOError>("Can not read from descriptor {}: buffer is not writable", fd);
+	}
+
+	// Read outside the lock into storage of our own, published below in a single exclusive section
+	Buffers::Data data(max);
+	const ByteSpan region(data.data(), data.size());
+	auto read = IO::Read(fd, std::span<const ByteSpan>(&region, 1));
+	if (read && *read > 0) {
+		data.resize(*read);
+		{
+			std::unique_lock lock(m_data_mutex);
+			Acquire();
+			Simple::Write(std::move(data));
+			m_counters.Stored(Simple::AvailableBytes());
+			Publish();
+		}
+		m_counters.Written(*read);
+		Notify();
+	}
+	return read;
 }
 
 void Shared::Reserve(const std::size_t& size) {
@@ -224,75 +572,731 @@ void Shared::Reserve(const std::size_t& size) {
 }
 
 void Shared::Seek(const std::ptrdiff_t& position, const Read::Position& mode) const {
-	std::unique_lock lock(m_data_mutex);
-	Simple::Seek(position, mode);
+	{
+		std::unique_lock lock(m_data_mutex);
+		const_cast<Shared*>(this)->Acquire();
+		Simple::Seek(position, mode);
+		Publish();
+	}
+	Released();
 }
 
 std::size_t Shared::Size() const noexcept {
+	const std::size_t pending = Pending();
+	return m_end.load(std::memory_order_acquire) + pending;
+}
+
+StormByte::Expected<Simple, BufferOverflow> Shared::Slice(const std::size_t& offset, const std::size_t& length) const {
+	Drain();
 	std::shared_lock lock(m_data_mutex);
-	return Simple::Size();
+	return Simple::Slice(offset, length);
+}
+
+Shared::Statistics Shared::Stats() const noexcept {
+	return {
+		m_blocked_writes.load(std::memory_order_relaxed),
+		m_write_timeouts.load(std::memory_order_relaxed),
+		std::chrono::nanoseconds(m_blocked_nanoseconds.load(std::memory_order_relaxed)),
+		m_counters.BytesWritten(),
+		m_counters.BytesRead(),
+		m_counters.BytesExtracted(),
+		m_counters.Writes(),
+		m_counters.Reads(),
+		m_counters.PeakSize(),
+		m_counters.WaitTime(),
+#ifdef STORMBYTE_BUFFER_METRICS
+		m_data_mutex.WaitTimes(),
+		m_data_mutex.HoldTimes()
+#else
+		Metrics::Histogram(),
+		Metrics::Histogram()
+#endif
+	};
 }
 
 enum Status Shared::Status() const noexcept {
 	return m_status.load();
 }
 
+std::shared_ptr<Shared> Shared::Subscribe() {
+	auto subscriber = m_data.Resource() ? std::make_shared<Shared>(*m_data.Resource()) : std::make_shared<Shared>();
+	subscriber->m_status.store(m_status.load());
+	subscriber->Limit(m_high_water.load(), m_low_water.load());
+	std::unique_lock lock(m_data_mutex);
+	// A subscriber of a subscriber reads the same chunks
+	if (!m_stream) {
+		// Bytes held so far stay for the consumers of this buffer, the chunks follow them
+		m_stream = std::make_shared<Stream>();
+		m_stream->source = this;
+		m_stream_position = 0;
+		m_feed.store(m_stream.get());
+		m_broadcast.store(true);
+	}
+	std::lock_guard stream_lock(m_stream->mutex);
+	subscriber->m_stream = m_stream;
+	subscriber->m_stream_position = m_stream->end.load();
+	subscriber->m_stream_cursor.store(subscriber->m_stream_position);
+	subscriber->m_feed.store(m_stream.get());
+	m_stream->subscribers.push_back(subscriber);
+	return subscriber;
+}
+
+SharedTransaction Shared::Transaction() {
+	std::unique_lock lock(m_data_mutex);
+	Acquire();
+	return SharedTransaction(*this, std::move(lock));
+}
+
+ExpectedData<BufferOverflow> Shared::TryExtract(const std::size_t& length) {
+	// A deadline already reached checks the buffer once without sleeping
+	return ExtractBefore(length, std::chrono::steady_clock::now());
+}
+
+ExpectedData<BufferOverflow> Shared::TryRead(const std::size_t& length) const {
+	return ReadBefore(length, std::chrono::steady_clock::now());
+}
+
+Write::Status Shared::TryWrite(const ConstByteSpan& data) {
+	if (!IsWritable()) {
+		return Write::Status::Error;
+	}
+	if (m_broadcast.load(std::memory_order_relaxed)) {
+		if (m_consumers.load() > 0 && !HasRoom()) {
+			return Write::Status::Timeout;
+		}
+		for (const auto& subscriber: Subscribers()) {
+			if (!subscriber->HasRoom()) {
+				return Write::Status::Timeout;
+			}
+		}
+		auto chunk = Chunk();
+		chunk.Write(data);
+		return Broadcast(std::move(chunk), std::chrono::steady_clock::now());
+	}
+	// Same check as the one a write passes without waiting, so nothing is recorded
+	if (!HasRoom()) {
+		return Write::Status::Timeout;
+	}
+	return Store(data);
+}
+
 void Shared::Unlock() {
+	Publish();
 	m_data_mutex.unlock();
 }
 
 Write::Status Shared::Write(const Buffers::Data& data) {
-	if (!IsWritable()) {
-		return Write::Status::Error;
+	if (m_broadcast.load(std::memory_order_relaxed)) {
+		auto chunk = Chunk();
+		chunk.Write(data);
+		return Broadcast(std::move(chunk), std::nullopt);
+	}
+	if (const auto admitted = Admit(std::nullopt); admitted != Write::Status::Success) {
+		return admitted;
+	}
+	if (PushRing(ConstByteSpan(data.data(), data.size()))) {
+		m_counters.Written(data.size());
+		Notify();
+		return Write::Status::Success;
 	}
 	std::unique_lock lock(m_data_mutex);
-	return Simple::Write(data);
+	Acquire();
+	const auto status = Simple::Write(data);
+	m_counters.Stored(Simple::AvailableBytes());
+	Publish();
+	lock.unlock();
+	m_counters.Written(data.size());
+	Notify();
+	return status;
 }
 
 Write::Status Shared::Write(Buffers::Data&& data) {
-	if (!IsWritable()) {
-		return Write::Status::Error;
+	if (m_broadcast.load(std::memory_order_relaxed)) {
+		// The vector is adopted once and its storage shared by the readers
+		auto chunk = Chunk();
+		chunk.Write(std::move(data));
+		return Broadcast(std::move(chunk), std::nullopt);
+	}
+	if (const auto admitted = Admit(std::nullopt); admitted != Write::Status::Success) {
+		return admitted;
+	}
+	const std::size_t size = data.size();
+	// The ring would copy the vector: an empty buffer adopts a large one under the lock instead, unless
+	// it allocates from a memory resource and would copy the vector anyway
+	const bool adopt = size >= AdoptThreshold && !m_data.Resource() && m_end.load(std::memory_order_acquire) == 0 && (!m_ring || m_ring->Empty());
+	if (!adopt && PushRing(ConstByteSpan(data.data(), data.size()))) {
+		m_counters.Written(size);
+		Notify();
+		return Write::Status::Success;
 	}
 	std::unique_lock lock(m_data_mutex);
-	return Simple::Write(std::move(data));
+	Acquire();
+	const auto status = Simple::Write(std::move(data));
+	m_counters.Stored(Simple::AvailableBytes());
+	Publish();
+	lock.unlock();
+	m_counters.Written(size);
+	Notify();
+	return status;
 }
 
 Write::Status Shared::Write(const Simple& buffer) {
-	if (!IsWritable()) {
-		return Write::Status::Error;
+	if (m_broadcast.load(std::memory_order_relaxed)) {
+		auto chunk = Chunk();
+		chunk.Write(buffer);
+		return Broadcast(std::move(chunk), std::nullopt);
 	}
-	std::unique_lock lock(m_data_mutex);
-	return Simple::Write(buffer);
+	if (const auto admitted = Admit(std::nullopt); admitted != Write::Status::Success) {
+		return admitted;
+	}
+	return Deliver(buffer);
 }
 
 Write::Status Shared::Write(Simple&& buffer) {
-	if (!IsWritable()) {
-		return Write::Status::Error;
+	if (m_broadcast.load(std::memory_order_relaxed)) {
+		auto chunk = Chunk();
+		chunk.Write(std::move(buffer));
+		return Broadcast(std::move(chunk), std::nullopt);
+	}
+	if (const auto admitted = Admit(std::nullopt); admitted != Write::Status::Success) {
+		return admitted;
 	}
+	const std::size_t size = buffer.Simple::Size();
 	std::unique_lock lock(m_data_mutex);
-	return Simple::Write(std::move(buffer));
+	Acquire();
+	const auto status = Simple::Write(std::move(buffer));
+	m_counters.Stored(Simple::AvailableBytes());
+	Publish();
+	lock.unlock();
+	m_counters.Written(size);
+	Notify();
+	return status;
 }
 
 Write::Status Shared::Write(const std::string& data) {
-	if (!IsWritable()) {
-		return Write::Status::Error;
+	if (m_broadcast.load(std::memory_order_relaxed)) {
+		auto chunk = Chunk();
+		chunk.Write(data);
+		return Broadcast(std::move(chunk), std::nullopt);
+	}
+	if (const auto admitted = Admit(std::nullopt); admitted != Write::Status::Success) {
+		return admitted;
+	}
+	if (PushRing(ConstByteSpan(reinterpret_cast<const Byte*>(data.data()), data.size()))) {
+		m_counters.Written(data.size());
+		Notify();
+		return Write::Status::Success;
+	}
+	std::unique_lock lock(m_data_mutex);
+	Acquire();
+	const auto status = Simple::Write(data);
+	m_counters.Stored(Simple::AvailableBytes());
+	Publish();
+	lock.unlock();
+	m_counters.Written(data.size());
+	Notify();
+	return status;
+}
+
+Write::Status Shared::Write(const ConstByteSpan& data) {
+	if (m_broadcast.load(std::memory_order_relaxed)) {
+		auto chunk = Chunk();
+		chunk.Write(data);
+		return Broadcast(std::move(chunk), std::nullopt);
+	}
+	if (const auto admitted = Admit(std::nullopt); admitted != Write::Status::Success) {
+		return admitted;
+	}
+	return Store(data);
+}
+
+Write::Status Shared::Write(const ConstByteSpan& data, const std::chrono::steady_clock::duration& timeout) {
+	if (m_broadcast.load(std::memory_order_relaxed)) {
+		auto chunk = Chunk();
+		chunk.Write(data);
+		return Broadcast(std::move(chunk), std::chrono::steady_clock::now() + timeout);
+	}
+	if (const auto admitted = Admit(std::chrono::steady_clock::now() + timeout); admitted != Write::Status::Success) {
+		return admitted;
 	}
+	return Store(data);
+}
+
+Write::Status Shared::Store(const ConstByteSpan& data) {
+	if (PushRing(data)) {
+		m_counters.Written(data.size());
+		Notify();
+		return Write::Status::Success;
+	}
+	std::unique_lock lock(m_data_mutex);
+	Acquire();
+	const auto status = Simple::Write(data);
+	m_counters.Stored(Simple::AvailableBytes());
+	Publish();
+	lock.unlock();
+	m_counters.Written(data.size());
+	Notify();
+	return status;
+}
+
+StormByte::Expected<std::size_t, BufferIOError> Shared::WriteTo(const int& fd) {
 	std::unique_lock lock(m_data_mutex);
-	return Simple::Write(data);
+	Acquire();
+	auto written = Simple::WriteTo(fd);
+	Publish();
+	return written;
 }
 
-Read::Status Shared::Wait(const std::size_t length) const noexcept {
-	if (HasEnoughData(length)) {
+Read::Status Shared::Fetch(const ByteSpan& output, const bool& advance) const {
+	while (true) {
+		if (Wait(output.size()) != Read::Status::Success) {
+			return Read::Status::Error;
+		}
+		Drain(output.size());
+		std::shared_lock lock(m_data_mutex);
+		const auto position = Claim(output.size(), advance);
+		if (!position) {
+			continue;
+		}
+		const auto claimed = Simple::Span().subspan(*position, output.size());
+		std::copy(claimed.begin(), claimed.end(), output.begin());
+		lock.unlock();
+		if (advance) {
+			m_counters.Read(output.size());
+			Released();
+		}
 		return Read::Status::Success;
-	} else {
-		while (IsWritable() && !HasEnoughData(length)) {
-			std::this_thread::yield();
-			std::this_thread::sleep_for(std::chrono::milliseconds(100)); // Add a small sleep to reduce CPU usage
+	}
+}
+
+StormByte::Expected<std::uint64_t, BufferOverflow> Shared::FetchVarint(const bool& is_signed) const {
+	// The length is only known once the last byte arrived: wait for one more byte while incomplete
+	std::size_t needed = 1;
+	while (true) {
+		if (Wait(needed) != Read::Status::Success) {
+			return StormByte::Unexpected<BufferOverflow>("Not enough data to read varint.");
+		}
+		Drain(needed);
+		std::shared_lock lock(m_data_mutex);
+		std::size_t position = m_cursor.load(std::memory_order_acquire);
+		const auto available = Simple::Span().subspan(std::min(position, Simple::Size()));
+		std::uint64_t value;
+		const std::size_t length = Binary::DecodeVarint(available, is_signed, value);
+		if (length == 0) {
+			if (available.size() >= Binary::MaxVarintSize) {
+				return StormByte::Unexpected<BufferOverflow>("Malformed varint at position {}", position);
+			}
+			needed = available.size() + 1;
+			continue;
+		}
+		if (!m_cursor.compare_exchange_strong(position, position + length, std::memory_order_acq_rel, std::memory_order_acquire)) {
+			// Another reader moved the position: decode again from the new one
+			needed = 1;
+			continue;
 		}
+		lock.unlock();
+		m_counters.Read(length);
+		Released();
+		return value;
+	}
+}
+
+ExpectedData<BufferOverflow> Shared::FetchUntil(const ConstByteSpan& delimiter) const {
+	std::size_t scanned = 0, position = 0;
+	while (true) {
+		std::size_t available;
+		Drain();
+		{
+			std::shared_lock lock(m_data_mutex);
+			const std::size_t cursor = m_cursor.load(std::memory_order_acquire);
+			if (cursor != position) {
+				// Another reader moved the position: search everything again
+				scanned = 0;
+				position = cursor;
+			}
+			const auto unread = Simple::Span().subspan(std::min(position, Simple::Size()));
+			const auto found = Search::Find(unread.subspan(scanned), delimiter);
+			if (found) {
+				std::size_t expected = position;
+				if (!m_cursor.compare_exchange_strong(expected, position + scanned + *found + delimiter.size(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+					continue;
+				}
+				Buffers::Data data(unread.begin(), unread.begin() + scanned + *found);
+				lock.unlock();
+				m_counters.Read(scanned + *found + delimiter.size());
+				Released();
+				return data;
+			}
+			available = unread.size();
+			// A delimiter split across writes may start in the last bytes searched
+			scanned = available >= delimiter.size() ? available - delimiter.size() + 1 : 0;
+		}
+		if (Wait(available + 1) != Read::Status::Success) {
+			return StormByte::Unexpected<BufferOverflow>("Delimiter not found before the end of the buffer.");
+		}
+	}
+}
+
+StormByte::Buffers::Data Shared::Snapshot(const std::size_t& offset, const std::size_t& length) const {
+	Drain();
+	std::shared_lock lock(m_data_mutex);
+	const auto range = HexDump::Range(Simple::Span(), offset, length);
+	return Buffers::Data(range.begin(), range.end());
+}
+
+Read::Status Shared::Wait(const std::size_t length, const std::optional<std::chrono::steady_clock::time_point>& deadline) const noexcept {
+	while (true) {
+		// Take the generation before checking: a change after this point makes the wait below return at once
+		const std::uint32_t generation = m_generation.load();
 		if (HasEnoughData(length)) {
 			return Read::Status::Success;
-		} else {
-			return Read::Status::Error;
+		}
+		if (!IsWritable()) {
+			// Data may have been written right before the status changed
+			return HasEnoughData(length) ? Read::Status::Success : Read::Status::Error;
+		}
+		const auto start = Metrics::Enabled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+		const bool woken = Sleep(generation, deadline);
+		if constexpr (Metrics::Enabled) {
+			m_counters.Waited(std::chrono::steady_clock::now() - start);
+		}
+		if (!woken) {
+			return Read::Status::Timeout;
+		}
+	}
+}
+
+void Shared::Acquire(const std::size_t& length) {
+	// Readers holding the shared lock only advanced the cursor
+	m_position = m_cursor.load(std::memory_order_relaxed);
+	// Ring bytes were written before any broadcast chunk
+	DrainLocked();
+	Pull(length);
+}
+
+std::size_t Shared::Buffered() const noexcept {
+	const std::size_t position = m_cursor.load(std::memory_order_acquire);
+	const std::size_t end = m_end.load(std::memory_order_acquire);
+	return end > position ? end - position : 0;
+}
+
+bool Shared::HasRoom() const noexcept {
+	const std::size_t high_water = m_high_water.load();
+	return high_water == 0 || AvailableBytes() < high_water;
+}
+
+std::optional<std::size_t> Shared::Claim(const std::size_t& length, const bool& advance) const noexcept {
+	// Under the shared lock the size is fixed and the cursor only moves forward
+	const std::size_t size = Simple::Size();
+	std::size_t position = m_cursor.load(std::memory_order_acquire);
+	do {
+		if (position > size || length > size - position) {
+			return std::nullopt;
+		}
+		if (!advance) {
+			return position;
+		}
+	} while (!m_cursor.compare_exchange_weak(position, position + length, std::memory_order_acq_rel, std::memory_order_acquire));
+	return position;
+}
+
+void Shared::Drain(const std::size_t& length) const {
+	// Bytes are only moved for readers needing more than the buffer holds, the others claim them directly
+	if (Pending() > 0 && Buffered() < length) {
+		std::unique_lock lock(m_data_mutex);
+		// Pending bytes are already part of the content, moving them into the storage does not change it
+		const_cast<Shared*>(this)->Acquire(length);
+		Publish();
+	}
+}
+
+void Shared::DrainLocked() {
+	if (!m_ring) {
+		return;
+	}
+	// A reader extracting straight from the ring only copies the bytes out, wait for it
+	while (m_ring_reader.test_and_set(std::memory_order_acquire)) {
+		std::this_thread::yield();
+	}
+	const auto [first, second] = m_ring->Readable();
+	try {
+		Append(first.data(), first.size());
+		Append(second.data(), second.size());
+	}
+	catch (...) {
+		m_ring_reader.clear(std::memory_order_release);
+		throw;
+	}
+	m_ring->Consume(first.size() + second.size());
+	// Published before the ring is handed back, so a reader extracting from it sees the moved bytes precede it
+	m_end.store(Simple::Size(), std::memory_order_release);
+	m_ring_reader.clear(std::memory_order_release);
+	if (!first.empty()) {
+		m_counters.Stored(Simple::AvailableBytes());
+	}
+}
+
+std::optional<StormByte::Buffers::Data> Shared::ExtractRing(const std::size_t& length) {
+	if (!m_ring || m_ring->Size() < length) {
+		return std::nullopt;
+	}
+	// Allocated before taking the ring so the reader flag is never held across a throw
+	Buffers::Data data(length);
+	if (m_ring_reader.test_and_set(std::memory_order_acquire)) {
+		return std::nullopt;
+	}
+	// The buffer is checked after the ring: bytes written before the ring ones are then visible in it
+	const bool extract = m_ring->Size() >= length && Buffered() == 0;
+	if (extract) {
+		m_ring->Pop(ByteSpan(data.data(), data.size()));
+	}
+	m_ring_reader.clear(std::memory_order_release);
+	if (!extract) {
+		return std::nullopt;
+	}
+	return data;
+}
+
+std::size_t Shared::Pending() const noexcept {
+	std::size_t pending = m_ring ? m_ring->Size() : 0;
+	if (const Stream* stream = m_feed.load(std::memory_order_acquire)) {
+		// Loaded before the end, which only grows, so it is never past it
+		const std::uint64_t position = m_stream_cursor.load(std::memory_order_acquire);
+		pending += static_cast<std::size_t>(stream->end.load(std::memory_order_acquire) - position);
+	}
+	return pending;
+}
+
+void Shared::Publish() const noexcept {
+	m_end.store(Simple::Size(), std::memory_order_release);
+	m_cursor.store(m_position, std::memory_order_release);
+	// Stored last: a reader seeing the chunks taken also sees them in the size
+	m_stream_cursor.store(m_stream_position, std::memory_order_release);
+}
+
+void Shared::Pull(const std::size_t& length) {
+	if (!m_stream) {
+		return;
+	}
+	std::lock_guard lock(m_stream->mutex);
+	auto& chunks = m_stream->chunks;
+	// Positions always fall between chunks: the next one starts at it, or at the oldest kept if it was freed
+	auto chunk = std::lower_bound(chunks.begin(), chunks.end(), m_stream_position, [](const Stream::Chunk& chunk, const std::uint64_t& position) {
+		return chunk.offset < position;
+	});
+	const bool oldest = chunk == chunks.begin();
+	const auto unread = [this] {
+		const std::size_t size = Simple::Size();
+		return size > m_position ? size - m_position : 0;
+	};
+	bool taken = false;
+	for (; chunk != chunks.end() && unread() < length; ++chunk) {
+		// Shares the chunk storage while nothing is held
+		Simple::Write(chunk->bytes);
+		m_stream_position = chunk->offset + chunk->bytes.Simple::Size();
+		taken = true;
+	}
+	if (taken) {
+		m_counters.Stored(Simple::AvailableBytes());
+		if (oldest) {
+			Reclaim(*m_stream);
+		}
+	}
+}
+
+bool Shared::PushRing(const ConstByteSpan& data) noexcept {
+	// A contended push falls back to the locked path, keeping the ring single producer
+	if (!m_ring || m_ring_writer.test_and_set(std::memory_order_acquire)) {
+		return false;
+	}
+	const bool pushed = m_ring->Push(data);
+	m_ring_writer.clear(std::memory_order_release);
+	return pushed;
+}
+
+void Shared::Notify() const noexcept {
+	m_generation.fetch_add(1);
+	// Streams of small writes would pay a wake call each while the woken reader waits to be scheduled
+	if (m_sleepers.exchange(false)) {
+		std::vector<std::function<void()>> parked;
+		{
+			// Taking the mutex orders the wake after the last check of any thread about to sleep
+			std::lock_guard lock(m_wait_mutex);
+			m_wait_cv.notify_all();
+			parked.swap(m_parked);
+		}
+		// Callbacks check the buffer again, so they run without the mutex
+		for (const auto& wake: parked) {
+			wake();
 		}
 	}
-}
\ No newline at end of file
+}
+
+bool Shared::Park(const std::uint32_t& generation, std::function<void()> wake) const {
+	std::lock_guard lock(m_wait_mutex);
+	m_sleepers.store(true);
+	if (m_generation.load() != generation) {
+		return false;
+	}
+	m_parked.push_back(std::move(wake));
+	return true;
+}
+
+bool Shared::Sleep(const std::uint32_t& generation, const std::optional<std::chrono::steady_clock::time_point>& deadline) const {
+	std::unique_lock lock(m_wait_mutex);
+	while (true) {
+		// Raised before every check: a late wake meant for an older generation may have lowered it
+		m_sleepers.store(true);
+		if (m_generation.load() != generation) {
+			return true;
+		}
+		if (!deadline) {
+			m_wait_cv.wait(lock);
+		}
+		else if (m_wait_cv.wait_until(lock, *deadline) == std::cv_status::timeout) {
+			return m_generation.load() != generation;
+		}
+	}
+}
+
+void Shared::Released() const noexcept {
+	if (m_high_water.load(std::memory_order_relaxed) != 0) {
+		Notify();
+	}
+}
+
+Write::Status Shared::Admit(const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+	if (!IsWritable()) {
+		return Write::Status::Error;
+	}
+	if (HasRoom()) {
+		return Write::Status::Success;
+	}
+
+	// Over the high-water mark: wait for readers to drain the buffer down to the low-water mark
+	m_blocked_writes.fetch_add(1, std::memory_order_relaxed);
+	const auto start = std::chrono::steady_clock::now();
+	auto status = Write::Status::Success;
+	while (true) {
+		const std::uint32_t generation = m_generation.load();
+		if (!IsWritable()) {
+			status = Write::Status::Error;
+			break;
+		}
+		if (m_high_water.load() == 0 || AvailableBytes() <= m_low_water.load()) {
+			break;
+		}
+		if (!Sleep(generation, deadline)) {
+			m_write_timeouts.fetch_add(1, std::memory_order_relaxed);
+			status = Write::Status::Timeout;
+			break;
+		}
+	}
+	const auto blocked = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+	m_blocked_nanoseconds.fetch_add(static_cast<std::uint64_t>(blocked.count()), std::memory_order_relaxed);
+	return status;
+}
+
+Write::Status Shared::Broadcast(Simple&& chunk, const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+	if (!IsWritable()) {
+		return Write::Status::Error;
+	}
+	const std::size_t size = chunk.Simple::Size();
+	if (size == 0) {
+		return Write::Status::Success;
+	}
+	// Wait for room in every reader first, so a timeout leaves all of them without the chunk
+	if (m_consumers.load() > 0) {
+		if (const auto admitted = Admit(deadline); admitted != Write::Status::Success) {
+			return admitted;
+		}
+	}
+	for (const auto& subscriber: Subscribers()) {
+		if (subscriber->Admit(deadline) == Write::Status::Timeout) {
+			return Write::Status::Timeout;
+		}
+	}
+	{
+		// Exclusive, so chunks keep the order of the writes and wait for a transaction in progress
+		std::unique_lock lock(m_data_mutex);
+		Emit(std::move(chunk), false);
+	}
+	m_counters.Written(size);
+	Notify();
+	for (const auto& subscriber: Subscribers()) {
+		subscriber->Notify();
+	}
+	return Write::Status::Success;
+}
+
+Simple Shared::Chunk() const {
+	return m_data.Resource() ? Simple(*m_data.Resource()) : Simple();
+}
+
+Write::Status Shared::Deliver(const Simple& buffer) {
+	std::unique_lock lock(m_data_mutex);
+	Acquire();
+	const auto status = Simple::Write(buffer);
+	m_counters.Stored(Simple::AvailableBytes());
+	Publish();
+	lock.unlock();
+	m_counters.Written(buffer.Simple::Size());
+	Notify();
+	return status;
+}
+
+void Shared::Emit(Simple&& chunk, const bool& held) {
+	std::lock_guard lock(m_stream->mutex);
+	const std::uint64_t offset = m_stream->end.load(std::memory_order_relaxed);
+	const std::uint64_t end = offset + chunk.Simple::Size();
+	m_stream->chunks.push_back({ offset, std::move(chunk) });
+	m_stream->end.store(end, std::memory_order_release);
+	// Without consumers nobody reads this buffer, so it must not hold the chunks back
+	if (held || m_consumers.load() == 0) {
+		m_stream_position = end;
+		m_stream_cursor.store(end, std::memory_order_release);
+	}
+	Reclaim(*m_stream);
+}
+
+void Shared::Reclaim(Stream& stream) {
+	std::uint64_t passed = stream.end.load(std::memory_order_relaxed);
+	if (stream.source && stream.source->m_consumers.load() > 0) {
+		passed = std::min(passed, stream.source->m_stream_position);
+	}
+	std::erase_if(stream.subscribers, [&passed](const std::weak_ptr<Shared>& subscriber) {
+		auto alive = subscriber.lock();
+		if (!alive) {
+			return true;
+		}
+		passed = std::min(passed, alive->m_stream_position);
+		return false;
+	});
+	while (!stream.chunks.empty() && stream.chunks.front().offset + stream.chunks.front().bytes.Simple::Size() <= passed) {
+		stream.chunks.pop_front();
+	}
+}
+
+std::vector<std::shared_ptr<Shared>> Shared::Subscribers() const {
+	std::vector<std::shared_ptr<Shared>> subscribers;
+	Stream* stream = m_feed.load(std::memory_order_acquire);
+	if (!stream) {
+		return subscribers;
+	}
+	std::lock_guard lock(stream->mutex);
+	// Subscribers whose consumers are all gone are dropped
+	std::erase_if(stream->subscribers, [&subscribers](const std::weak_ptr<Shared>& subscriber) {
+		auto alive = subscriber.lock();
+		if (!alive) {
+			return true;
+		}
+		subscribers.push_back(std::move(alive));
+		return false;
+	});
+	return subscribers;
+}
+
+std::size_t Shared::Unread() const noexcept {
+	const std::size_t pending = Pending();
+	return Buffered() + pending;
+}
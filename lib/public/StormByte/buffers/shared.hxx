@@ -1,13 +1,22 @@
 #pragma once
 
+#include <StormByte/buffers/metrics.hxx>
+#include <StormByte/buffers/ring.hxx>
 #include <StormByte/buffers/simple.hxx>
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <string>
+#include <vector>
 
 /**
  * @namespace Buffers
@@ -22,6 +31,208 @@
  * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
  */
 namespace StormByte::Buffers {
+    /**
+     * @class SharedView
+     * @brief A read-only view into a `Shared` buffer which pins the data while it is alive.
+     *
+     * The view holds a shared lock on the buffer it was taken from, so the bytes it points to
+     * cannot be moved or released by writers until the view is destroyed. Other readers are not blocked.
+     * A view from @see Shared::ReadView wakes the writers waiting for room once it released the lock.
+     *
+     * **Lifetime rules:**
+     * - Keep views short-lived: writers on the same buffer wait until every view is gone.
+     * - Do not call any other member of the same `Shared` buffer (or of a `Consumer`/`Producer` bound to it)
+     *   from the thread holding the view, as it would try to lock the buffer again.
+     * - The view must not outlive the buffer it was taken from.
+     */
+    class STORMBYTE_PUBLIC SharedView final {
+        friend class Shared;
+
+        public:
+            /**
+             * @brief Deleted copy constructor
+             * A view owns a lock and can't be copied.
+             */
+            SharedView(const SharedView& other)                                 = delete;
+
+            /**
+             * @brief Move constructor
+             * @param other View to move from.
+             */
+            SharedView(SharedView&& other) noexcept;
+
+            /**
+             * @brief Destructor
+             * Releases the lock on the buffer.
+             */
+            ~SharedView() noexcept;
+
+            /**
+             * @brief Deleted copy assignment operator
+             */
+            SharedView& operator=(const SharedView& other)                      = delete;
+
+            /**
+             * @brief Move assignment operator
+             * @param other View to move from.
+             * @return Reference to the updated view.
+             */
+            SharedView& operator=(SharedView&& other) noexcept;
+
+            /**
+             * @brief Accesses a byte of the view
+             * @param index Index of the byte.
+             * @return Reference to the byte.
+             */
+            const Byte&                                                         operator[](const std::size_t& index) const noexcept {
+                return m_span[index];
+            }
+
+            /**
+             * @brief Iterator to the first byte
+             */
+            ConstByteSpan::iterator                                             begin() const noexcept {
+                return m_span.begin();
+            }
+
+            /**
+             * @brief Iterator past the last byte
+             */
+            ConstByteSpan::iterator                                             end() const noexcept {
+                return m_span.end();
+            }
+
+            /**
+             * @brief Checks if the view is empty
+             * @return True if the view holds no bytes.
+             */
+            bool                                                                Empty() const noexcept {
+                return m_span.empty();
+            }
+
+            /**
+             * @brief Retrieves the size of the view
+             * @return Number of bytes in the view.
+             */
+            std::size_t                                                         Size() const noexcept {
+                return m_span.size();
+            }
+
+            /**
+             * @brief Retrieves the viewed bytes
+             * @return A read-only span valid while this view is alive.
+             */
+            ConstByteSpan                                                       Span() const noexcept {
+                return m_span;
+            }
+
+        private:
+            std::shared_lock<Metrics::SharedMutex> m_lock;                      ///< Lock pinning the buffer data.
+            ConstByteSpan m_span;                                               ///< Viewed bytes.
+            const Shared* m_consumed;                                           ///< Buffer whose writers are woken after unlocking, null if nothing was consumed.
+
+            /**
+             * @brief Constructor
+             * @param lock Acquired shared lock on the buffer.
+             * @param span Viewed bytes.
+             * @param consumed Buffer the viewed bytes were consumed from, null for a peek.
+             */
+            SharedView(std::shared_lock<Metrics::SharedMutex>&& lock, ConstByteSpan span, const Shared* consumed = nullptr) noexcept:
+            m_lock(std::move(lock)), m_span(span), m_consumed(consumed) {}
+
+            /**
+             * @brief Releases the lock, then wakes the writers waiting for the consumed bytes
+             */
+            void                                                                Release() noexcept;
+    };
+
+    class Shared;
+
+    namespace Async {
+        class Waiter;
+    }
+
+    /**
+     * @class SharedTransaction
+     * @brief Exclusive access to a `Shared` buffer for a sequence of operations.
+     *
+     * The transaction locks the buffer once and exposes its contents as a `Simple` buffer, so compound
+     * operations such as checking for enough data, peeking a header and extracting a frame run without
+     * locking between them and no other thread sees the buffer halfway through. Other threads see every
+     * change at once when the transaction is destroyed, which also wakes the ones waiting for data or room.
+     *
+     * **Lifetime rules:**
+     * - Operations never wait: they behave as on a `Simple` buffer holding the data available when the
+     *   transaction started, and writes ignore the bound set by @see Shared::Limit.
+     * - Bytes appended to a broadcasting buffer reach its subscribers when the transaction ends.
+     * - Do not call any other member of the same `Shared` buffer (or of a `Consumer`/`Producer` bound to it)
+     *   from the thread holding the transaction, as it would try to lock the buffer again.
+     * - The transaction must not outlive the buffer it was taken from.
+     */
+    class STORMBYTE_PUBLIC SharedTransaction final {
+        friend class Shared;
+
+        public:
+            /**
+             * @brief Deleted copy constructor
+             * A transaction owns a lock and can't be copied.
+             */
+            SharedTransaction(const SharedTransaction& other)                   = delete;
+
+            /**
+             * @brief Move constructor
+             * @param other Transaction to move from, which no longer owns the buffer.
+             */
+            SharedTransaction(SharedTransaction&& other) noexcept;
+
+            /**
+             * @brief Destructor
+             * Hands the contents back to the buffer, releases the lock and wakes the waiting threads.
+             */
+            ~SharedTransaction() noexcept;
+
+            /**
+             * @brief Deleted copy assignment operator
+             */
+            SharedTransaction& operator=(const SharedTransaction& other)        = delete;
+
+            /**
+             * @brief Deleted move assignment operator
+             * A transaction is bound to a single buffer for its whole life.
+             */
+            SharedTransaction& operator=(SharedTransaction&& other)             = delete;
+
+            /**
+             * @brief Accesses the locked buffer contents
+             * @return Reference to the contents, valid while this transaction is alive.
+             */
+            Simple&                                                             operator*() noexcept {
+                return m_contents;
+            }
+
+            /**
+             * @brief Accesses the locked buffer contents
+             * @return Pointer to the contents, valid while this transaction is alive.
+             */
+            Simple*                                                             operator->() noexcept {
+                return &m_contents;
+            }
+
+        private:
+            Shared* m_buffer;                                                   ///< Buffer the contents are handed back to, null once moved from.
+            std::unique_lock<Metrics::SharedMutex> m_lock;                      ///< Lock held on the buffer.
+            std::size_t m_appended;                                             ///< Bytes the buffer had appended when the transaction started.
+            Simple m_contents;                                                  ///< Buffer contents while the transaction is alive.
+
+            /**
+             * @brief Constructor
+             * Takes the contents of the buffer, `lock` must hold its mutex.
+             * @param buffer Buffer to work on.
+             * @param lock Acquired exclusive lock on the buffer.
+             */
+            SharedTransaction(Shared& buffer, std::unique_lock<Metrics::SharedMutex>&& lock) noexcept;
+    };
+
     /**
      * @class Shared
      * @brief A thread-safe version of the `Simple` buffer.
@@ -33,18 +244,61 @@ namespace StormByte::Buffers {
      * - **Thread-Safe**: Ensures thread safety using a `std::shared_mutex`. Reads allow concurrent access, while writes are exclusive.
      * - **Flexible Data Management**: Supports appending, extracting, and reading data with thread-safe guarantees.
      * - **Position Management**: Provides methods to manage the read position, including seeking and resetting.
+     *   The position is an atomic cursor: concurrent readers each claim their own bytes, and
+     *   @see Position, @see AvailableBytes, @see Size and @see Empty answer without locking.
      *
      * This class is ideal for scenarios where multiple threads need to read from or write to a shared buffer
      * while maintaining data integrity and avoiding race conditions.
+     *
+     * A buffer can be bounded with @see Limit, so fast writers wait for readers instead of growing it without limit.
+     *
+     * A buffer can also broadcast: once @see Subscribe was called, written bytes are kept once in a list of chunks
+     * which this buffer and every subscriber read through their own position, and a chunk is freed once all of them passed it.
      */
     class STORMBYTE_PUBLIC Shared: public Simple {
+        friend class Async::Waiter;
+        friend class Consumer;
+        friend class SharedView;
+        friend class SharedTransaction;
+
         public:
+            /**
+             * @brief Moved byte vectors at least this large are adopted by an empty buffer instead of copied through the ring.
+             */
+            static constexpr std::size_t AdoptThreshold = 1024;
+
+            /**
+             * @struct Statistics
+             * @brief Snapshot of the buffer counters.
+             */
+            struct Statistics {
+                std::uint64_t blocked_writes;									///< Writes that found the buffer at its high-water mark and waited.
+                std::uint64_t write_timeouts;									///< Timed writes that gave up before the buffer drained.
+                std::chrono::nanoseconds blocked_time;							///< Total time writers spent waiting for the buffer to drain.
+                std::uint64_t bytes_written;									///< Bytes written. This and the fields below stay zero unless metrics are enabled.
+                std::uint64_t bytes_read;										///< Bytes passed by reads advancing the read position.
+                std::uint64_t bytes_extracted;									///< Bytes removed by extractions.
+                std::uint64_t writes;											///< Write operations.
+                std::uint64_t reads;											///< Read and extract operations.
+                std::size_t peak_size;											///< Largest number of unread bytes seen.
+                std::chrono::nanoseconds wait_time;								///< Total time readers slept waiting for data.
+                Metrics::Histogram lock_wait;									///< Time taken to acquire the buffer lock.
+                Metrics::Histogram lock_hold;									///< Time the buffer lock was held exclusively.
+            };
+
             /**
              * @brief Default constructor
              * Initializes an empty shared buffer.
              */
             Shared() noexcept;
 
+            /**
+             * @brief Constructor using a custom memory resource
+             * @param resource Memory resource to allocate from (e.g. a `Buffers::Pool`), must outlive the buffer.
+             * @see Simple::Simple(std::pmr::memory_resource&)
+             */
+            explicit Shared(std::pmr::memory_resource& resource) noexcept;
+
             /**
              * @brief Constructor reserving initial size
              * @param size Size of the buffer to reserve.
@@ -82,23 +336,38 @@ namespace StormByte::Buffers {
              */
             Shared(const std::span<const Byte>& data);
 
+            /**
+             * @brief Constructor backing writes with a lock-free ring
+             *
+             * Writes of bytes that fit in the ring's free space are pushed without taking the buffer lock, and
+             * readers move them into the buffer before looking at it. Writes that do not fit, including
+             * writes of whole buffers which keep sharing their storage, take the lock and move the pending ring
+             * bytes first, so a full ring never blocks a writer and order is kept. Concurrent writers stay safe,
+             * but only one of them gets the lock-free path at a time.
+             * @param ring Ring to use, its size bounds the bytes waiting to be read by the lock-free path.
+             */
+            explicit Shared(Ring&& ring);
+
             /**
              * @brief Copy constructor
+             * Shares the storage of `other` as @see Simple::Simple(const Simple&) does.
              * @param other Shared buffer to copy from.
              */
             Shared(const Shared& other);
 
             /**
              * @brief Move constructor
+             * A broadcasting `other` hands its subscribers over, which then receive what this buffer writes.
+             * Consumers stay bound to `other`. May allocate while taking the bytes `other` did not store yet.
              * @param other Shared buffer to move from.
              */
-            Shared(Shared&& other) noexcept;
+            Shared(Shared&& other);
 
             /**
              * @brief Destructor
-             * Cleans up the shared buffer.
+             * Cleans up the shared buffer, its subscribers keep reading the chunks already broadcast.
              */
-            virtual ~Shared() noexcept override = default;
+            virtual ~Shared() noexcept override;
 
             /**
              * @brief Copy assignment operator
@@ -112,7 +381,7 @@ namespace StormByte::Buffers {
              * @param other Shared buffer to move from.
              * @return Reference to the updated shared buffer.
              */
-            Shared& 															operator=(Shared&& other) noexcept;
+            Shared& 															operator=(Shared&& other);
 
             /**
              * @brief Sets the buffer status
@@ -163,8 +432,19 @@ namespace StormByte::Buffers {
 			 */
 			template <typename NumericType, typename = std::enable_if_t<std::is_arithmetic_v<std::decay_t<NumericType>>>>
 			Shared& operator<<(const NumericType& value) {
-				std::unique_lock lock(m_data_mutex);
-				Simple::operator<<(value);
+				if (m_broadcast.load(std::memory_order_relaxed)) {
+					Write(ConstByteSpan(reinterpret_cast<const Byte*>(&value), sizeof(NumericType)));
+					return *this;
+				}
+				{
+					std::unique_lock lock(m_data_mutex);
+					Acquire();
+					Simple::operator<<(value);
+					m_counters.Written(sizeof(NumericType));
+					m_counters.Stored(Simple::AvailableBytes());
+					Publish();
+				}
+				Notify();
 				return *this;
 			}
 
@@ -176,6 +456,7 @@ namespace StormByte::Buffers {
 
 			/**
 			 * @brief Gets the available bytes to read from current position
+			 * Answered without locking, from the read position and size last published.
 			 * @return Number of bytes available to read.
 			 */
 			virtual size_t 														AvailableBytes() const noexcept;
@@ -202,7 +483,7 @@ namespace StormByte::Buffers {
              * @brief Discards data from the buffer
              * Thread-safe version of @see Simple::Discard.
              */
-            void 																Discard(const std::size_t& length, const Read::Position& mode) noexcept override;
+            void 																Discard(const std::size_t& length, const Read::Position& mode) override;
 
             /**
              * @brief Checks if the read position is at the end
@@ -229,6 +510,22 @@ namespace StormByte::Buffers {
              */
             ExpectedData<BufferOverflow> 										Extract(const size_t& length) override;
 
+            /**
+             * @brief Extracts a specific size of data, waiting for it until a deadline.
+             * @param length Length of the data to read and remove from the shared buffer.
+             * @param deadline Time to stop waiting at.
+             * @return The requested data, a `BufferTimeout` error if it did not arrive in time, or a
+             *         `BufferOverflow` error if the buffer can no longer provide it.
+             * @see Extract(const size_t&)
+             */
+            ExpectedData<BufferOverflow> 										Extract(const size_t& length, const std::chrono::steady_clock::time_point& deadline);
+
+            /**
+             * @brief Extracts a specific size of data, waiting for it at most `timeout`.
+             * @see Extract(const size_t&, const std::chrono::steady_clock::time_point&)
+             */
+            ExpectedData<BufferOverflow> 										Extract(const size_t& length, const std::chrono::steady_clock::duration& timeout);
+
             /**
              * @brief Extracts a specific size of data and moves it directly into the provided buffer.
              * 
@@ -248,18 +545,54 @@ namespace StormByte::Buffers {
              */
             bool 																HasEnoughData(const std::size_t& length) const override;
 
+            /**
+             * @brief Finds the first occurrence of a byte in the unread data, without waiting for it
+             * Thread-safe version of @see Simple::Find.
+             */
+            std::optional<std::size_t> 											Find(const Byte& value) const override;
+
+            /**
+             * @brief Finds the first occurrence of a byte sequence in the unread data, without waiting for it
+             * Thread-safe version of @see Simple::Find.
+             */
+            std::optional<std::size_t> 											Find(const ConstByteSpan& pattern) const override;
+
             /**
              * @brief Retrieves the stored value as a hexadecimal string
              * Thread-safe version of @see Simple::HexData.
              */
             std::string 														HexData(const std::size_t& column_size = 16) const override;
 
+            /**
+             * @brief Retrieves a range of the stored value as a hexadecimal string
+             * Thread-safe version of @see Simple::HexData.
+             */
+            std::string 														HexData(const std::size_t& offset, const std::size_t& length, const std::size_t& column_size = 16) const override;
+
+            /**
+             * @brief Streams a range of the stored value as hexadecimal to an output stream
+             * Thread-safe version of @see Simple::HexData.
+             */
+            void 																HexData(std::ostream& output, const std::size_t& offset = 0, const std::size_t& length = std::numeric_limits<std::size_t>::max(), const std::size_t& column_size = 16) const override;
+
+            /**
+             * @brief Streams a range of the stored value as hexadecimal to a producer
+             * Thread-safe version of @see Simple::HexData.
+             */
+            Write::Status 														HexData(Producer& output, const std::size_t& offset = 0, const std::size_t& length = std::numeric_limits<std::size_t>::max(), const std::size_t& column_size = 16) const override;
+
             /**
              * @brief Checks if the buffer is at the end of the file/data in case its write end have been closed
 			 * @return True if the buffer is at the end and write closed, false otherwise.
              */
             bool 																IsEoF() const noexcept override;
 
+            /**
+             * @brief Checks if writes go to the broadcast chunks, see @see Subscribe.
+             * @return True once a subscriber was added.
+             */
+            bool 																IsBroadcasting() const noexcept;
+
             /**
              * @brief Checks if the buffer is readable.
              * 
@@ -276,9 +609,23 @@ namespace StormByte::Buffers {
              */
             bool 																IsWritable() const noexcept;
 
+            /**
+             * @brief Bounds the unread bytes the buffer holds
+             *
+             * Once `high_water` unread bytes are stored, writes wait until readers bring them down to `low_water`,
+             * so the waiting writers are not woken for every byte read. A single write is never split, so it may
+             * take the buffer over the mark. Bytes skipped by `Read` count as drained even though they stay
+             * stored until extracted or discarded. Writers also stop waiting when the buffer stops being writable.
+             *
+             * @param high_water Unread bytes at which writes wait, 0 to remove the bound.
+             * @param low_water Unread bytes at which waiting writes resume, clamped below `high_water`.
+             */
+            void 																Limit(const std::size_t& high_water, const std::size_t& low_water = 0) noexcept;
+
             /**
              * @brief Locks the shared buffer for exclusive access
              * Prevents other threads from reading or writing to the buffer until `Unlock()` is called.
+             * Other members can't be called while locked, use @see Transaction to work on the locked buffer.
              */
             void 																Lock();
 
@@ -288,9 +635,22 @@ namespace StormByte::Buffers {
              */
             ExpectedByte<BufferOverflow> 										Peek() const override;
 
+            /**
+             * @brief Retrieves a guarded view of the next bytes without advancing the read position.
+             *
+             * Zero-copy version of @see Simple::PeekView. Like @see Read, it waits for the requested
+             * data while the buffer is writable. The returned view keeps the buffer locked for reading
+             * while it is alive, see `SharedView` for its lifetime rules.
+             *
+             * @param length Number of bytes to view.
+             * @return `SharedView` on the requested bytes, or an `Unexpected` with a `BufferOverflow` error
+             *         if insufficient data exists and no more data can arrive.
+             */
+            Expected<SharedView, BufferOverflow>                                PeekView(const std::size_t& length) const;
+
             /**
              * @brief Retrieves the read position
-             * Thread-safe version of @see Simple::Position.
+             * Thread-safe version of @see Simple::Position. Never locks: readers advance the position atomically.
              */
             std::size_t 														Position() const noexcept override;
 
@@ -307,6 +667,50 @@ namespace StormByte::Buffers {
              */
             ExpectedData<BufferOverflow> 										Read(const size_t& length) const override;
 
+            /**
+             * @brief Reads a specific size of data, waiting for it until a deadline.
+             * @param length Length of the data to read.
+             * @param deadline Time to stop waiting at.
+             * @return A copy of the requested data, a `BufferTimeout` error if it did not arrive in time, or a
+             *         `BufferOverflow` error if the buffer can no longer provide it.
+             * @see Read(const size_t&)
+             */
+            ExpectedData<BufferOverflow> 										Read(const size_t& length, const std::chrono::steady_clock::time_point& deadline) const;
+
+            /**
+             * @brief Reads a specific size of data, waiting for it at most `timeout`.
+             * @see Read(const size_t&, const std::chrono::steady_clock::time_point&)
+             */
+            ExpectedData<BufferOverflow> 										Read(const size_t& length, const std::chrono::steady_clock::duration& timeout) const;
+
+            /**
+             * @brief Retrieves a guarded view of the next bytes and advances the read position.
+             *
+             * Zero-copy version of @see Read. It waits for the requested data while the buffer is
+             * writable and returns a view which keeps the buffer locked for reading while it is alive,
+             * see `SharedView` for its lifetime rules.
+             *
+             * @param length Number of bytes to view.
+             * @return `SharedView` on the requested bytes, or an `Unexpected` with a `BufferOverflow` error
+             *         if insufficient data exists and no more data can arrive.
+             */
+            Expected<SharedView, BufferOverflow>                                ReadView(const std::size_t& length) const;
+
+            /**
+             * @brief Reads from a file descriptor and appends the data to the shared buffer
+             *
+             * Thread-safe version of @see Simple::ReadFrom. The system call runs without holding the
+             * buffer lock, so consumers are never blocked by a slow descriptor. The data is read into
+             * a temporary vector of up to `max` bytes, which is adopted without copying when the
+             * buffer is empty and has no memory resource, and copied in otherwise.
+             *
+             * @param fd File descriptor to read from.
+             * @param max Maximum number of bytes to read.
+             * @return Number of bytes read (0 at end of file), or a `BufferIOError` on failure or if
+             *         the buffer is not writable.
+             */
+            Expected<std::size_t, BufferIOError> 								ReadFrom(const int& fd, const std::size_t& max) override;
+
             /**
              * @brief Reserves shared buffer size
              * Thread-safe version of @see Simple::Reserve.
@@ -325,6 +729,71 @@ namespace StormByte::Buffers {
              */
             std::size_t 														Size() const noexcept override;
 
+            /**
+             * @brief Creates a buffer holding a range of the stored data without copying it
+             * Thread-safe version of @see Simple::Slice.
+             */
+            Expected<Simple, BufferOverflow> 									Slice(const std::size_t& offset, const std::size_t& length) const;
+
+            /**
+             * @brief Retrieves a snapshot of the buffer counters
+             *
+             * Backpressure counters are always kept. Throughput and lock counters are only kept when the library is built
+             * with metrics, see @see Metrics. Operations made through a @see Transaction count as a single lock hold.
+             * @return Current statistics.
+             */
+            Statistics 															Stats() const noexcept;
+
+            /**
+             * @brief Adds a subscriber, turning the buffer into a broadcast
+             *
+             * From then on every write, including the ones made through @see Transaction, `operator>>` or
+             * @see ExtractInto, is appended once to a list of chunks. This buffer and each subscriber keep their
+             * own position in it and take the chunks as their readers need them, sharing a chunk's storage
+             * while they hold no unconsumed bytes, so every reader sees the whole stream at its own pace.
+             * A chunk is freed once every reader passed it.
+             *
+             * This buffer keeps receiving the stream while any `Consumer` of it exists. A subscriber receives the
+             * bytes written after it subscribed, the status changes and the bound set by @see Limit, which then
+             * waits for the slowest reader. A subscriber is dropped once nothing references it anymore.
+             * @return Buffer of the new subscriber.
+             */
+            std::shared_ptr<Shared> 											Subscribe();
+
+            /**
+             * @brief Locks the buffer for a sequence of operations taking the lock only once
+             *
+             * Pending ring bytes are moved into the buffer first, so the transaction sees every completed write.
+             * @return Transaction giving access to the locked buffer, see `SharedTransaction` for its lifetime rules.
+             */
+            SharedTransaction 													Transaction();
+
+            /**
+             * @brief Extracts a specific size of data only if it is already available, never waiting.
+             * @param length Length of the data to read and remove from the shared buffer.
+             * @return The requested data, a `BufferTimeout` error if it is not there yet, or a `BufferOverflow`
+             *         error if the buffer can no longer provide it.
+             */
+            ExpectedData<BufferOverflow> 										TryExtract(const size_t& length);
+
+            /**
+             * @brief Reads a specific size of data only if it is already available, never waiting.
+             * @param length Length of the data to read.
+             * @return A copy of the requested data, a `BufferTimeout` error if it is not there yet, or a
+             *         `BufferOverflow` error if the buffer can no longer provide it.
+             */
+            ExpectedData<BufferOverflow> 										TryRead(const size_t& length) const;
+
+            /**
+             * @brief Writes raw bytes only if there is room for them right now, never waiting.
+             *
+             * Unlike a write with a zero timeout, a full buffer is not counted as a blocked write nor as a
+             * timeout in @see Stats, so it can be retried as often as needed. @see Limit
+             * @param data Bytes to write.
+             * @return Write::Status of the operation, `Write::Status::Timeout` if the buffer is full.
+             */
+            Write::Status 														TryWrite(const ConstByteSpan& data);
+
             /**
              * @brief Gets the buffer status
              */
@@ -374,31 +843,293 @@ namespace StormByte::Buffers {
 
             /**
              * @brief Moves a byte vector and writes it to the current shared buffer
-             * Thread-safe version of @see Simple::Write.
+             * Thread-safe version of @see Simple::Write. A buffer holding nothing takes the vector itself
+             * when it is at least @see AdoptThreshold bytes, so forwarding a chunk copies no byte.
              *
              * @param data Byte vector to write.
              * @return Write::Status of the operation.
              */
             Write::Status 														Write(Buffers::Data&& data) override;
 
+            /**
+             * @brief Writes raw bytes to the current shared buffer
+             * Thread-safe version of @see Simple::Write.
+             *
+             * @param data Bytes to write.
+             * @return Write::Status of the operation.
+             */
+            Write::Status 														Write(const ConstByteSpan& data) override;
+
+            /**
+             * @brief Writes raw bytes, waiting at most `timeout` for a bounded buffer to drain
+             *
+             * A zero timeout tries the write without waiting. @see Limit
+             *
+             * @param data Bytes to write.
+             * @param timeout Longest time to wait for room.
+             * @return Write::Status of the operation, `Write::Status::Timeout` if nothing was written in time.
+             */
+            Write::Status 														Write(const ConstByteSpan& data, const std::chrono::steady_clock::duration& timeout);
+
+            /**
+             * @brief Writes the unread data to a file descriptor
+             * Thread-safe version of @see Simple::WriteTo. The buffer stays locked during the write.
+             *
+             * @param fd File descriptor to write to.
+             * @return Number of bytes written, or a `BufferIOError` if nothing could be written.
+             */
+            Expected<std::size_t, BufferIOError> 								WriteTo(const int& fd) override;
+
         protected:
-            mutable std::shared_mutex m_data_mutex; 							///< Mutex for thread safety.
+            mutable Metrics::SharedMutex m_data_mutex; 						///< Mutex for thread safety, timed when metrics are enabled.
             std::atomic<enum Status> m_status;									///< Buffer status.
+            mutable std::atomic<std::uint32_t> m_generation;					///< Bumped on every change a waiting reader or writer may care about.
+            mutable std::atomic<bool> m_sleepers;								///< Set by threads before sleeping in @see Sleep, cleared by the @see Notify waking them.
+            mutable std::mutex m_wait_mutex;									///< Orders sleeping against waking.
+            mutable std::condition_variable m_wait_cv;							///< Sleeping readers and writers.
+            mutable std::vector<std::function<void()>> m_parked;				///< Suspended coroutines to wake, registered by @see Park.
+
+            /**
+             * @brief Copies a range of the stored data while holding the read lock.
+             *
+             * Lets slow work such as hex dumping run on the copy without blocking writers.
+             *
+             * @param offset First byte of the range, counted from the start of the stored data.
+             * @param length Number of bytes of the range, clamped to the stored data.
+             * @return Copy of the range.
+             */
+            Buffers::Data 														Snapshot(const std::size_t& offset, const std::size_t& length) const;
+
+            /**
+             * @brief Copies the bytes at the read position, waiting for them to be written
+             * Thread-safe version of @see Simple::Fetch.
+             */
+            Read::Status 														Fetch(const ByteSpan& output, const bool& advance) const override;
+
+            /**
+             * @brief Decodes a LEB128 varint at the read position, waiting for its remaining bytes to be written
+             * Thread-safe version of @see Simple::FetchVarint.
+             */
+            Expected<std::uint64_t, BufferOverflow> 							FetchVarint(const bool& is_signed) const override;
+
+            /**
+             * @brief Reads the data before a delimiter, waiting for the delimiter to be written
+             * Thread-safe version of @see Simple::FetchUntil. Fails only once the buffer is closed or in
+             * error without the delimiter; bytes already searched are not searched again while waiting.
+             */
+            ExpectedData<BufferOverflow> 										FetchUntil(const ConstByteSpan& delimiter) const override;
 
             /**
              * @brief Waits for a specific amount of data to become available in the buffer.
              * 
              * This function blocks until the requested amount of data is available in the buffer
-             * or until the buffer is marked as `EoF` (End of File) or `Error`.
+             * or until the buffer is marked as `EoF` (End of File) or `Error`. It sleeps in @see Sleep
+             * instead of polling, so it wakes as soon as a write, clear or status change calls @see Notify.
              * 
              * **Behavior:**
              * - If the required data becomes available, the function returns `Read::Status::Success`.
              * - If the buffer is marked as `EoF` or encounters an error while waiting, the function
              *   returns `Read::Status::Error`.
+             * - If the deadline passes first, the function returns `Read::Status::Timeout`.
              * 
              * @param length The number of bytes to wait for.
+             * @param deadline Time to stop waiting at, or none to wait indefinitely.
              * @return `Read::Status` indicating the result of the wait operation.
              */
-            Read::Status 														Wait(const std::size_t length) const noexcept;
+            Read::Status 														Wait(const std::size_t length, const std::optional<std::chrono::steady_clock::time_point>& deadline = std::nullopt) const noexcept;
+
+            /**
+             * @brief Wakes the readers blocked in @see Wait and writers blocked by @see Limit so they check the buffer again.
+             *
+             * Must be called after the data or status changed. It never takes `m_data_mutex`,
+             * so setting a status never blocks on a lock taken with @see Lock.
+             */
+            void 																Notify() const noexcept;
+
+            /**
+             * @brief Registers a callback for the next @see Notify after `generation` was read from `m_generation`.
+             *
+             * The non-blocking counterpart of @see Sleep used by coroutines: the callback runs once, from the
+             * thread calling @see Notify after it released every lock, and must check the buffer again.
+             *
+             * @param generation Value of `m_generation` read before checking the awaited condition.
+             * @param wake Callback to run.
+             * @return False, without registering, if the generation already changed.
+             */
+            bool 																Park(const std::uint32_t& generation, std::function<void()> wake) const;
+
+            /**
+             * @brief Sleeps until @see Notify is called after `generation` was read from `m_generation`.
+             * @param generation Value of `m_generation` read before checking the awaited condition.
+             * @param deadline Time to give up at, or none to wait indefinitely.
+             * @return False if the deadline passed first.
+             */
+            bool 																Sleep(const std::uint32_t& generation, const std::optional<std::chrono::steady_clock::time_point>& deadline) const;
+
+        private:
+            mutable std::atomic<std::size_t> m_cursor;							///< Read position, advanced by readers holding the shared lock.
+            mutable std::atomic<std::size_t> m_end;								///< Size as of the last exclusive lock, for lock-free queries.
+            std::unique_ptr<Ring> m_ring;										///< Optional lock-free path for writes, null if not used.
+            std::atomic_flag m_ring_writer;										///< Held by the writer pushing into `m_ring`.
+            mutable std::atomic_flag m_ring_reader;								///< Held by the reader consuming from `m_ring`.
+            std::atomic<std::size_t> m_high_water;								///< Unread bytes at which writes wait, 0 if unbounded.
+            std::atomic<std::size_t> m_low_water;								///< Unread bytes at which waiting writes resume.
+            std::atomic<std::uint64_t> m_blocked_writes;						///< Writes that had to wait for room.
+            std::atomic<std::uint64_t> m_write_timeouts;						///< Timed writes that gave up.
+            std::atomic<std::uint64_t> m_blocked_nanoseconds;					///< Time writers spent waiting for room.
+            [[no_unique_address]] mutable Metrics::Counters m_counters;		///< Throughput counters, empty when metrics are compiled out.
+            struct Stream;
+            std::atomic<bool> m_broadcast;										///< Set once writes go to `m_stream`, only on the buffer which broadcasts.
+            std::shared_ptr<Stream> m_stream;									///< Broadcast chunks read by this buffer, null if none.
+            std::atomic<Stream*> m_feed;										///< Same as `m_stream`, for lock-free queries.
+            std::uint64_t m_stream_position;									///< Stream offset taken so far; changed holding `m_data_mutex` and the stream mutex.
+            mutable std::atomic<std::uint64_t> m_stream_cursor;				///< `m_stream_position` as of the last exclusive lock, for lock-free queries.
+            std::atomic<std::size_t> m_consumers;								///< `Consumer` instances bound to this buffer.
+
+            /**
+             * @brief Waits until a write may proceed under the bound set by @see Limit.
+             * @param deadline Time to give up at, or none to wait indefinitely.
+             * @return `Success` to write, `Error` if the buffer is not writable, `Timeout` if the deadline passed.
+             */
+            Write::Status 														Admit(const std::optional<std::chrono::steady_clock::time_point>& deadline);
+
+            /**
+             * @brief Appends a chunk to the broadcast once every reader has room.
+             * @param chunk Bytes to broadcast, see @see Chunk.
+             * @param deadline Time to give up waiting for room at, or none to wait indefinitely.
+             * @return Write::Status of the operation.
+             */
+            Write::Status 														Broadcast(Simple&& chunk, const std::optional<std::chrono::steady_clock::time_point>& deadline);
+
+            /**
+             * @brief Creates an empty chunk allocating from the buffer's memory resource, so readers can share it.
+             */
+            Simple 																Chunk() const;
+
+            /**
+             * @brief Appends a chunk to the stream; `m_data_mutex` must be held exclusively.
+             * @param chunk Bytes to append.
+             * @param held Whether this buffer already holds the bytes, as after a transaction.
+             */
+            void 																Emit(Simple&& chunk, const bool& held);
+
+            /**
+             * @brief Appends an admitted buffer under the lock and wakes the readers.
+             * @param buffer Buffer to append.
+             * @return Write::Status of the operation.
+             */
+            Write::Status 														Deliver(const Simple& buffer);
+
+            /**
+             * @brief Implements the extractions, waiting for the data until `deadline` if given.
+             */
+            ExpectedData<BufferOverflow> 										ExtractBefore(const std::size_t& length, const std::optional<std::chrono::steady_clock::time_point>& deadline);
+
+            /**
+             * @brief Implements the reads, waiting for the data until `deadline` if given.
+             */
+            ExpectedData<BufferOverflow> 										ReadBefore(const std::size_t& length, const std::optional<std::chrono::steady_clock::time_point>& deadline) const;
+
+            /**
+             * @brief Takes over the read position kept in `m_cursor`, drains the ring and takes broadcast chunks;
+             * `m_data_mutex` must be held exclusively.
+             *
+             * Every exclusive section starts with it and ends with @see Publish.
+             * @param length Unread bytes the caller needs, see @see Pull.
+             */
+            void 																Acquire(const std::size_t& length = std::numeric_limits<std::size_t>::max());
+
+            /**
+             * @brief Retrieves the unread bytes held by the buffer itself, ring excluded, without locking.
+             */
+            std::size_t 														Buffered() const noexcept;
+
+            /**
+             * @brief Checks if a write may proceed at once under the bound set by @see Limit, without locking.
+             */
+            bool 																HasRoom() const noexcept;
+
+            /**
+             * @brief Claims `length` unread bytes for the calling reader; `m_data_mutex` must be held shared.
+             * @param length Bytes to claim.
+             * @param advance Whether to move the read position past them, or only check they are available.
+             * @return Position of the claimed bytes, none if not enough are available.
+             */
+            std::optional<std::size_t> 											Claim(const std::size_t& length, const bool& advance = true) const noexcept;
+
+            /**
+             * @brief Moves the pending bytes into the buffer when it holds fewer than `length` unread bytes.
+             *
+             * The write lock is only taken when bytes are moved.
+             * @param length Unread bytes the caller needs in the buffer, all pending bytes are moved by default.
+             */
+            void 																Drain(const std::size_t& length = std::numeric_limits<std::size_t>::max()) const;
+
+            /**
+             * @brief Moves the bytes pending in the ring into the buffer; `m_data_mutex` must be held exclusively.
+             */
+            void 																DrainLocked();
+
+            /**
+             * @brief Extracts bytes straight from the ring, without locking, when no unread byte of the buffer precedes them.
+             * @param length Bytes to extract.
+             * @return The bytes, none if the ring is not used, busy or does not hold them all.
+             */
+            std::optional<Buffers::Data> 										ExtractRing(const std::size_t& length);
+
+            /**
+             * @brief Retrieves the bytes written through the ring or broadcast and not moved into the buffer yet, without locking.
+             */
+            std::size_t 														Pending() const noexcept;
+
+            /**
+             * @brief Pushes bytes into the ring if there is one, it is not in use by another writer, and they fit.
+             * @param data Bytes to push.
+             * @return True if the bytes were pushed.
+             */
+            bool 																PushRing(const ConstByteSpan& data) noexcept;
+
+            /**
+             * @brief Takes whole broadcast chunks until `length` unread bytes are held; `m_data_mutex` must be held exclusively.
+             *
+             * A chunk taken while no unconsumed byte is held shares its storage instead of being copied.
+             * @param length Unread bytes the caller needs.
+             */
+            void 																Pull(const std::size_t& length);
+
+            /**
+             * @brief Publishes the read position and size for readers and lock-free queries; `m_data_mutex` must be held exclusively.
+             */
+            void 																Publish() const noexcept;
+
+            /**
+             * @brief Wakes writers waiting for room after unread bytes were consumed, if the buffer is bounded.
+             */
+            void 																Released() const noexcept;
+
+            /**
+             * @brief Appends bytes once admitted, through the ring when possible.
+             * @param data Bytes to write.
+             * @return Write::Status of the operation.
+             */
+            Write::Status 														Store(const ConstByteSpan& data);
+
+            /**
+             * @brief Frees the chunks every reader passed; the stream mutex must be held.
+             */
+            static void 														Reclaim(Stream& stream);
+
+            /**
+             * @brief Retrieves the live subscribers, forgetting the ones no longer referenced.
+             */
+            std::vector<std::shared_ptr<Shared>> 								Subscribers() const;
+
+            /**
+             * @brief Retrieves the unread bytes from the published position and size, without locking.
+             *
+             * Ring and broadcast bytes are included. They are counted before the buffer, so bytes being moved between both
+             * are counted twice rather than missed.
+             */
+            std::size_t 														Unread() const noexcept;
     };
 }
\ No newline at end of file
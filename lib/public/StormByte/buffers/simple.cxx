@@ -1,36 +1,37 @@
+#include <StormByte/buffers/hexdump.hxx>
+#include <StormByte/buffers/io.hxx>
+#include <StormByte/buffers/search.hxx>
 #include <StormByte/buffers/simple.hxx>
 
 #include <algorithm>
 #include <cstring>
-#include <format>
+#include <utility>
 
 using namespace StormByte::Buffers;
 
-Simple::Simple() noexcept : m_data(), m_position(0), m_minimum_chunk_size(0) {}
+Simple::Simple() noexcept : m_data(), m_head(0), m_position(0), m_minimum_chunk_size(0), m_appended(0) {}
 
-Simple::Simple(const std::size_t& size): m_data(size), m_position(0), m_minimum_chunk_size(size) {}
+Simple::Simple(std::pmr::memory_resource& resource) noexcept : m_data(&resource), m_head(0), m_position(0), m_minimum_chunk_size(0), m_appended(0) {}
 
-Simple::Simple(const char* data, const std::size_t& length): m_data(length), m_position(0), m_minimum_chunk_size(0) {
-	if (data != nullptr && length > 0) {
-		std::copy(reinterpret_cast<const std::byte*>(data),
-				reinterpret_cast<const std::byte*>(data) + length,
-				m_data.begin());
-	}
-}
+Simple::Simple(const std::size_t& size): m_data(size), m_head(0), m_position(0), m_minimum_chunk_size(size), m_appended(0) {}
 
-Simple::Simple(const std::string& data): m_data(data.size()), m_position(0), m_minimum_chunk_size(0) {
-	if (!data.empty()) {
-		std::copy(reinterpret_cast<const std::byte*>(data.data()),
-				reinterpret_cast<const std::byte*>(data.data()) + data.size(),
-				m_data.begin());
+Simple::Simple(const char* data, const std::size_t& length): m_data(), m_head(0), m_position(0), m_minimum_chunk_size(0), m_appended(0) {
+	if (data != nullptr) {
+		m_data.Append(reinterpret_cast<const std::byte*>(data), length);
+	} else {
+		m_data = Storage(length);
 	}
 }
 
-Simple::Simple(const Buffers::Data& data): m_data(data), m_position(0), m_minimum_chunk_size(0) {}
+Simple::Simple(const std::string& data): m_data(reinterpret_cast<const std::byte*>(data.data()), data.size()), m_head(0), m_position(0), m_minimum_chunk_size(0), m_appended(0) {}
+
+Simple::Simple(const Buffers::Data& data): m_data(data.data(), data.size()), m_head(0), m_position(0), m_minimum_chunk_size(0), m_appended(0) {}
 
-Simple::Simple(Buffers::Data&& data): m_data(std::move(data)), m_position(0) {}
+Simple::Simple(Buffers::Data&& data): m_data(std::move(data)), m_head(0), m_position(0), m_minimum_chunk_size(0), m_appended(0) {}
 
-Simple::Simple(const std::span<const Byte>& data): m_data(data.begin(), data.end()), m_position(0), m_minimum_chunk_size(0) {}
+Simple::Simple(const std::span<const Byte>& data): m_data(data.data(), data.size()), m_head(0), m_position(0), m_minimum_chunk_size(0), m_appended(0) {}
+
+Simple::Simple(const std::span<const Byte>& data, std::shared_ptr<const void> owner): m_data(data, std::move(owner)), m_head(0), m_position(0), m_minimum_chunk_size(0), m_appended(0) {}
 
 Simple& Simple::operator<<(const Simple& buffer) {
 	Write(buffer);
@@ -59,50 +60,52 @@ Simple& Simple::operator<<(Buffers::Data&& data) {
 
 Simple& Simple::operator>>(Simple& buffer) {
 	if (this != &buffer) {
-		buffer.Write(m_data);
-		m_position = m_data.size();
+		buffer.Append(m_data.Data() + m_head, m_data.Size() - m_head);
+		m_position = m_data.Size() - m_head;
 	}
 	return buffer;
 }
 
 size_t Simple::AvailableBytes() const noexcept {
-	return m_data.size() - m_position;
+	return m_data.Size() - m_head - m_position;
 }
 
 size_t Simple::Capacity() const noexcept {
-	return m_data.capacity();
+	return m_data.Capacity() - m_head;
 }
 
 void Simple::Clear() {
-	m_data.clear();
+	m_data.Clear();
+	m_head = 0;
 	m_position = 0;
 }
 
 StormByte::Buffers::Data Simple::Data() const noexcept {
-	return m_data;
+	return Buffers::Data(m_data.Data() + m_head, m_data.Data() + m_data.Size());
 }
 
-void Simple::Discard(const std::size_t& length, const Read::Position& mode) noexcept {
+void Simple::Discard(const std::size_t& length, const Read::Position& mode) {
+	const std::size_t size = m_data.Size() - m_head;
 	std::size_t discard_start = 0;
 
 	// Determine the starting position for the discard operation based on the mode
 	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Begin)) {
 		discard_start = 0; // Discard from the beginning
 	} else if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::End)) {
-		discard_start = (length > m_data.size()) ? 0 : m_data.size() - length; // Discard from the end
+		discard_start = (length > size) ? 0 : size - length; // Discard from the end
 	} else if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Relative)) {
 		discard_start = m_position; // Discard relative to the current position
 	} else if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Absolute)) {
-		discard_start = (length > m_data.size()) ? m_data.size() : 0; // Discard from the absolute position
+		discard_start = (length > size) ? size : 0; // Discard from the absolute position
 	}
 
 	// Ensure the discard range is valid
-	discard_start = std::min(discard_start, m_data.size());
-	const std::size_t discard_end = std::min(discard_start + length, m_data.size());
+	discard_start = std::min(discard_start, size);
+	const std::size_t discard_end = std::min(discard_start + length, size);
 
 	// Perform the discard operation
 	if (discard_start < discard_end) {
-		m_data.erase(m_data.begin() + discard_start, m_data.begin() + discard_end);
+		Remove(discard_start, discard_end);
 	}
 
 	// Adjust the read position if necessary
@@ -114,82 +117,86 @@ void Simple::Discard(const std::size_t& length, const Read::Position& mode) noex
 }
 
 bool Simple::Empty() const noexcept {
-	return m_data.empty();
+	return m_data.Size() == m_head;
 }
 
 bool Simple::End() const noexcept {
-	return m_position == m_data.size();
+	return m_position == m_data.Size() - m_head;
 }
 
 ExpectedData<BufferOverflow> Simple::Extract(const std::size_t& length) {
-	if (m_position + length > m_data.size()) {
+	if (m_position + length > m_data.Size() - m_head) {
 		return StormByte::Unexpected<BufferOverflow>(
-			"Insufficient data to read {} bytes (only have {} bytes)", length, m_data.size() - m_position
+			"Insufficient data to read {} bytes (only have {} bytes)", length, m_data.Size() - m_head - m_position
 		);
 	}
 
-	auto start = m_data.begin() + m_position;
-	auto end = start + length;
+	// Whole buffer: hand over the storage itself
+	if (m_position == 0 && m_head == 0 && length == m_data.Size()) {
+		return m_data.Release();
+	}
 
-	Buffers::Data extracted_data(std::make_move_iterator(start), std::make_move_iterator(end));
+	auto start = m_data.Data() + m_head + m_position;
+	Buffers::Data extracted_data(start, start + length);
 
-	Discard(length, Read::Position::Relative);
+	Simple::Discard(length, Read::Position::Relative);
 
 	return extracted_data;
 }
 
 Read::Status Simple::ExtractInto(const std::size_t& length, Simple& output) noexcept {
-	if (!HasEnoughData(length)) {
+	if (m_position + length > m_data.Size() - m_head) {
 		return Read::Status::Error;
 	}
 
-	// Lock the data to extract
-	auto start = m_data.begin() + m_position;
-	auto end = start + length;
+	// Whole buffer into one holding nothing: hand the storage over, the consumed prefix goes with it
+	if (m_position == 0 && length == m_data.Size() - m_head && output.m_data.Size() == output.m_head && this != &output && output.m_data.SameResource(m_data)) {
+		output.m_data = std::move(m_data);
+		output.m_head = std::exchange(m_head, 0);
+		output.m_appended += length;
+		return Read::Status::Success;
+	}
 
-	// Move the data directly into the output buffer
-	output.m_data.reserve(output.m_data.size() + length);
-	output.m_data.insert(output.m_data.end(),
-						std::make_move_iterator(start),
-						std::make_move_iterator(end));
+	// Copy the data directly into the output buffer
+	output.Append(m_data.Data() + m_head + m_position, length);
 
 	// Use Discard to remove the extracted data
-	Discard(length, Read::Position::Relative);
+	Simple::Discard(length, Read::Position::Relative);
 
 	return Read::Status::Success;
 }
 
+std::optional<std::size_t> Simple::Find(const Byte& value) const {
+	// Seek may have moved the position past the end
+	return Search::Find(Simple::Span().subspan(std::min(m_position, Simple::Size())), value);
+}
+
+std::optional<std::size_t> Simple::Find(const ConstByteSpan& pattern) const {
+	return Search::Find(Simple::Span().subspan(std::min(m_position, Simple::Size())), pattern);
+}
+
 bool Simple::HasEnoughData(const std::size_t& length) const {
-	return m_position + length <= m_data.size();
+	return m_position + length <= m_data.Size() - m_head;
 }
 
 std::string Simple::HexData(const std::size_t& column_size) const {
-	std::string hex_data;
-	std::string hex_line, char_line;
-	std::size_t line_char_count = 0;
-
-	for (const auto& byte : m_data) {
-		hex_line += std::format("{:02X} ", static_cast<unsigned char>(byte));
-		char_line += std::isprint(static_cast<char>(byte)) ? static_cast<char>(byte) : '.';
-		if (++line_char_count == column_size) {
-			std::size_t padding = (column_size * 3) - hex_line.size();
-			hex_data += hex_line + std::string(padding, ' ') + "\t" + char_line + "\n";
-			hex_line.clear();
-			char_line.clear();
-			line_char_count = 0;
-		}
-	}
+	return HexDump::Encode(Simple::Span(), column_size);
+}
 
-	if (!hex_line.empty()) {
-		std::size_t padding = (column_size * 3) - hex_line.size();
-		hex_data += hex_line + std::string(padding, ' ') + "\t" + char_line + "\n";
-	}
+std::string Simple::HexData(const std::size_t& offset, const std::size_t& length, const std::size_t& column_size) const {
+	return HexDump::Encode(HexDump::Range(Simple::Span(), offset, length), column_size);
+}
+
+void Simple::HexData(std::ostream& output, const std::size_t& offset, const std::size_t& length, const std::size_t& column_size) const {
+	HexDump::Encode(HexDump::Range(Simple::Span(), offset, length), column_size, output);
+}
 
-	return hex_data;
+Write::Status Simple::HexData(Producer& output, const std::size_t& offset, const std::size_t& length, const std::size_t& column_size) const {
+	return HexDump::Encode(HexDump::Range(Simple::Span(), offset, length), column_size, output);
 }
 
 bool Simple::IsEoF() const noexcept {
-	return m_position >= m_data.size();
+	return m_position >= m_data.Size() - m_head;
 }
 
 std::size_t Simple::Position() const noexcept {
@@ -218,13 +225,13 @@ Read::Status Simple::Process(const std::size_t& length, Processor function, Simp
 }
 
 ExpectedData<BufferOverflow> Simple::Read(const std::size_t& length) const {
-	if (m_position + length > m_data.size()) {
+	if (m_position + length > m_data.Size() - m_head) {
 		return StormByte::Unexpected<BufferOverflow>(
 			"Insufficient data to read {} bytes (only have {} bytes)",
 			length,
-			m_data.size() - m_position);
+			m_data.Size() - m_head - m_position);
 	}
-	auto start = m_data.begin() + m_position;
+	auto start = m_data.Data() + m_head + m_position;
 	auto end = start + length;
 
 	Buffers::Data read_data(start, end); // Create a copy of the requested data
@@ -233,8 +240,68 @@ ExpectedData<BufferOverflow> Simple::Read(const std::size_t& length) const {
 	return read_data;
 }
 
+ExpectedConstByteSpan<BufferOverflow> Simple::ReadView(const std::size_t& length) const {
+	auto view = PeekView(length);
+	if (view) {
+		m_position += length;
+	}
+	return view;
+}
+
+ExpectedConstByteSpan<BufferOverflow> Simple::PeekView(const std::size_t& length) const {
+	if (m_position + length > m_data.Size() - m_head) {
+		return StormByte::Unexpected<BufferOverflow>(
+			"Insufficient data to view {} bytes (only have {} bytes)",
+			length,
+			m_data.Size() - m_head - m_position);
+	}
+	return std::span<const Byte>(m_data.Data() + m_head + m_position, length);
+}
+
+StormByte::Expected<std::size_t, BufferIOError> Simple::ReadFrom(const int& fd, const std::size_t& max) {
+	// Reclaim the consumed prefix instead of growing the storage when possible
+	if (m_head > 0 && m_data.Size() + max > m_data.Capacity()) {
+		Compact();
+	}
+	const std::size_t size = m_data.Size();
+	m_data.Resize(size + max);
+
+	const ByteSpan region(m_data.MutableData() + size, max);
+	auto read = IO::Read(fd, std::span<const ByteSpan>(&region, 1));
+	m_data.Resize(size + (read ? *read : 0));
+	m_appended += read ? *read : 0;
+	return read;
+}
+
+StormByte::Expected<std::string, BufferOverflow> Simple::ReadLine() const {
+	auto line = ReadUntil(Byte { '\n' });
+	if (!line) {
+		return StormByte::Unexpected(line.error());
+	}
+	std::size_t length = line->size();
+	if (length > 0 && (*line)[length - 1] == Byte { '\r' }) {
+		length--;
+	}
+	return std::string(reinterpret_cast<const char*>(line->data()), length);
+}
+
+ExpectedData<BufferOverflow> Simple::ReadUntil(const Byte& delimiter) const {
+	return FetchUntil(ConstByteSpan(&delimiter, 1));
+}
+
+ExpectedData<BufferOverflow> Simple::ReadUntil(const ConstByteSpan& delimiter) const {
+	return FetchUntil(delimiter);
+}
+
+ExpectedData<BufferOverflow> Simple::ReadUntil(const std::string& delimiter) const {
+	return FetchUntil(ConstByteSpan(reinterpret_cast<const Byte*>(delimiter.data()), delimiter.size()));
+}
+
 void Simple::Reserve(const std::size_t& size) {
-	m_data.reserve(size);
+	if (m_head > 0 && m_data.Capacity() - m_head < size) {
+		Compact();
+	}
+	m_data.Reserve(m_head + size);
 }
 
 void Simple::Seek(const std::ptrdiff_t& position, const Read::Position& mode) const {
@@ -245,7 +312,7 @@ void Simple::Seek(const std::ptrdiff_t& position, const Read::Position& mode) co
 	}
 	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::End)) {
 		new_position = static_cast<std::size_t>(
-			std::max<ptrdiff_t>(0, static_cast<ptrdiff_t>(m_data.size()) + position));
+			std::max<ptrdiff_t>(0, static_cast<ptrdiff_t>(m_data.Size() - m_head) + position));
 	}
 	if (static_cast<unsigned short>(mode) & static_cast<unsigned short>(Read::Position::Relative)) {
 		new_position = static_cast<std::size_t>(
@@ -259,62 +326,174 @@ void Simple::Seek(const std::ptrdiff_t& position, const Read::Position& mode) co
 }
 
 std::size_t Simple::Size() const noexcept {
-	return m_data.size();
+	return m_data.Size() - m_head;
+}
+
+StormByte::Expected<Simple, BufferOverflow> Simple::Slice(const std::size_t& offset, const std::size_t& length) const {
+	const std::size_t size = m_data.Size() - m_head;
+	if (offset > size || length > size - offset) {
+		return StormByte::Unexpected<BufferOverflow>(
+			"Can not slice {} bytes at offset {} (only have {} bytes)", length, offset, size);
+	}
+	// Same resource as this buffer, so the assignment shares the bytes
+	Simple slice = m_data.Resource() ? Simple(*m_data.Resource()) : Simple();
+	slice.m_data = m_data.Slice(m_head + offset, m_head + offset + length);
+	return slice;
 }
 
 const std::span<const Byte> Simple::Span() const noexcept {
-	return std::span<const Byte>(m_data.data(), m_data.size());
+	return std::span<const Byte>(m_data.Data() + m_head, m_data.Size() - m_head);
 }
 
-std::span<Byte> Simple::Span() noexcept {
-	return std::span<Byte>(m_data.data(), m_data.size());
+std::span<Byte> Simple::Span() {
+	return std::span<Byte>(m_data.MutableData() + m_head, m_data.Size() - m_head);
 }
 
 ExpectedByte<BufferOverflow> Simple::Peek() const {
-	if (m_position >= m_data.size()) {
+	if (m_position >= m_data.Size() - m_head) {
 		return StormByte::Unexpected<BufferOverflow>(
 			"Cannot peek: no more data available in the buffer."
 		);
 	}
-	return m_data[m_position];
+	return m_data[m_head + m_position];
 }
 
 Write::Status Simple::Write(const Simple& buffer) {
-	if (this != &buffer) {
-		m_data.reserve(m_data.size() + buffer.m_data.size());
-		m_data.insert(m_data.end(), buffer.m_data.begin(), buffer.m_data.end());
+	if (this == &buffer) {
+		return Write::Status::Success;
+	}
+	if (m_data.Size() == m_head && !buffer.m_data.IsInline() && m_data.SameResource(buffer.m_data)) {
+		// Nothing stored: share the storage, it is copied on the first modification of either buffer
+		m_data = buffer.m_data.Slice(buffer.m_head, buffer.m_data.Size());
+		m_head = 0;
+		m_appended += m_data.Size();
+	} else {
+		Append(buffer.m_data.Data() + buffer.m_head, buffer.m_data.Size() - buffer.m_head);
 	}
 	return Write::Status::Success;
 }
 
 Write::Status Simple::Write(Simple&& buffer) {
-	if (this != &buffer) {
-		m_data.reserve(m_data.size() + buffer.m_data.size());
-		m_data.insert(m_data.end(),
-					std::make_move_iterator(buffer.m_data.begin()),
-					std::make_move_iterator(buffer.m_data.end()));
-	}
-	return Write::Status::Success;
+	return Simple::Write(static_cast<const Simple&>(buffer));
 }
 
 Write::Status Simple::Write(const std::string& data) {
-	m_data.reserve(m_data.size() + data.size());
-	m_data.insert(m_data.end(),
-				reinterpret_cast<const std::byte*>(data.data()),
-				reinterpret_cast<const std::byte*>(data.data()) + data.size());
+	Append(reinterpret_cast<const std::byte*>(data.data()), data.size());
+	return Write::Status::Success;
+}
+
+Write::Status Simple::Write(const ConstByteSpan& data) {
+	Append(data.data(), data.size());
 	return Write::Status::Success;
 }
 
 Write::Status Simple::Write(const Buffers::Data& data) {
-	m_data.reserve(m_data.size() + data.size());
-	m_data.insert(m_data.end(), data.begin(), data.end());
+	Append(data.data(), data.size());
 	return Write::Status::Success;
 }
 
 Write::Status Simple::Write(Buffers::Data&& data) {
-	m_data.reserve(m_data.size() + data.size());
-	m_data.insert(m_data.end(),
-				std::make_move_iterator(data.begin()),
-				std::make_move_iterator(data.end()));
+	if (m_data.Size() == m_head) {
+		// Nothing stored: adopt the incoming storage instead of copying it
+		m_data.Adopt(std::move(data));
+		m_head = 0;
+		m_appended += m_data.Size();
+		return Write::Status::Success;
+	}
+	Append(data.data(), data.size());
 	return Write::Status::Success;
+}
+
+StormByte::Expected<std::size_t, BufferIOError> Simple::WriteTo(const int& fd) {
+	const ConstByteSpan region(m_data.Data() + m_head + m_position, m_data.Size() - m_head - m_position);
+	auto written = IO::Write(fd, std::span<const ConstByteSpan>(&region, 1));
+	if (written && *written > 0) {
+		Simple::Discard(*written, Read::Position::Relative);
+	}
+	return written;
+}
+
+void Simple::Append(const Byte* data, const std::size_t& length) {
+	if (length == 0) {
+		return;
+	}
+	// Reclaim the consumed prefix instead of growing the storage when possible
+	if (m_head > 0 && m_data.Size() + length > m_data.Capacity()) {
+		Compact();
+	}
+	m_data.Append(data, length);
+	m_appended += length;
+}
+
+void Simple::Compact() noexcept {
+	if (m_head == 0) {
+		return;
+	}
+	m_data.Consume(m_head);
+	m_head = 0;
+}
+
+Read::Status Simple::Fetch(const ByteSpan& output, const bool& advance) const {
+	auto view = Simple::PeekView(output.size());
+	if (!view) {
+		return Read::Status::Error;
+	}
+	std::memcpy(output.data(), view->data(), output.size());
+	if (advance) {
+		m_position += output.size();
+	}
+	return Read::Status::Success;
+}
+
+StormByte::Expected<std::uint64_t, BufferOverflow> Simple::FetchVarint(const bool& is_signed) const {
+	const auto available = Simple::Span().subspan(std::min(m_position, m_data.Size() - m_head));
+	std::uint64_t value;
+	const std::size_t length = Binary::DecodeVarint(available, is_signed, value);
+	if (length == 0) {
+		if (available.size() >= Binary::MaxVarintSize) {
+			return StormByte::Unexpected<BufferOverflow>("Malformed varint at position {}", m_position);
+		}
+		return StormByte::Unexpected<BufferOverflow>("Insufficient data to read varint (only have {} bytes)", available.size());
+	}
+	m_position += length;
+	return value;
+}
+
+ExpectedData<BufferOverflow> Simple::FetchUntil(const ConstByteSpan& delimiter) const {
+	const auto found = Simple::Find(delimiter);
+	if (!found) {
+		return StormByte::Unexpected<BufferOverflow>("Delimiter not found in the {} unread bytes", Simple::AvailableBytes());
+	}
+	auto data = Simple::Read(*found);
+	m_position += delimiter.size();
+	return data;
+}
+
+void Simple::Remove(const std::size_t& start, const std::size_t& end) {
+	const std::size_t size = m_data.Size() - m_head;
+	const std::size_t count = end - start;
+
+	if (count == size) {
+		// Everything is gone: keep the allocation and rewind
+		m_data.Clear();
+		m_head = 0;
+		return;
+	}
+
+	if (start == 0) {
+		// Consuming from the front is just a head advance
+		m_head += count;
+	} else if (start <= size - end) {
+		// Fewer bytes precede the range than follow it: shift the prefix forward
+		auto first = m_data.MutableData() + m_head;
+		std::move_backward(first, first + start, first + end);
+		m_head += count;
+	} else {
+		m_data.Erase(m_head + start, m_head + end);
+	}
+
+	// Once the consumed prefix outweighs the live data, moving the live data is amortized
+	if (m_head > m_data.Size() - m_head) {
+		Compact();
+	}
 }
\ No newline at end of file
@@ -1,10 +1,15 @@
 #pragma once
 
+#include <StormByte/buffers/binary.hxx>
 #include <StormByte/buffers/exception.hxx>
+#include <StormByte/buffers/storage.hxx>
 #include <StormByte/buffers/typedefs.hxx>
 #include <StormByte/visibility.h>
 
 #include <functional>
+#include <optional>
+#include <iosfwd>
+#include <limits>
 
 /**
  * @namespace Buffers
@@ -31,10 +36,14 @@ namespace StormByte::Buffers {
 	 * - **Flexible Data Management**: Supports appending data from various sources (e.g., strings, vectors, spans),
 	 *   extracting data destructively, and reading data non-destructively.
 	 * - **Position Management**: Provides methods to manage the read position, including seeking and resetting.
+	 * - **Inline Storage**: Payloads up to `Storage::InlineCapacity` bytes (such as serialized scalars) are kept
+	 *   inside the object and never touch the allocator.
 	 *
 	 * This class is ideal for scenarios where performance is critical, and thread safety is not required.
 	 */
 	class STORMBYTE_PUBLIC Simple {
+		friend class Chained;
+
 		public:
 			/**
 			 * @brief Default constructor
@@ -42,6 +51,14 @@ namespace StormByte::Buffers {
 			 */
 			Simple() noexcept;
 
+			/**
+			 * @brief Constructor using a custom memory resource
+			 * Initializes an empty simple buffer whose storage is allocated from `resource` instead of the
+			 * global allocator. Data read or extracted from it is returned as a plain `Buffers::Data`.
+			 * @param resource Memory resource to allocate from (e.g. a `Buffers::Pool`), must outlive the buffer.
+			 */
+			explicit Simple(std::pmr::memory_resource& resource) noexcept;
+
 			/**
 			 * @brief Constructor reserving initial size
 			 * @param size Size of the buffer to reserve.
@@ -80,8 +97,22 @@ namespace StormByte::Buffers {
 			 */
 			Simple(const std::span<const Byte>& data);
 
+			/**
+			 * @brief Constructor
+			 *
+			 * Refers to bytes owned by another object instead of copying them; they are only copied once
+			 * the buffer is modified.
+			 *
+			 * @param data Span of bytes to refer to.
+			 * @param owner Object keeping the bytes alive while the buffer, or any copy of it, refers to them.
+			 */
+			Simple(const std::span<const Byte>& data, std::shared_ptr<const void> owner);
+
 			/**
 			 * @brief Copy constructor
+			 *
+			 * O(1): heap storage is shared with `other` and only copied once either buffer is modified.
+			 *
 			 * @param other Simple buffer to copy from.
 			 */
 			Simple(const Simple& other)												= default;
@@ -100,6 +131,7 @@ namespace StormByte::Buffers {
 
 			/**
 			 * @brief Copy assignment operator
+			 * @see Simple(const Simple&)
 			 * @param other Simple buffer to copy from.
 			 * @return Reference to the updated simple buffer.
 			 */
@@ -107,10 +139,13 @@ namespace StormByte::Buffers {
 
 			/**
 			 * @brief Move assignment operator
+			 *
+			 * The storage is taken over if both buffers use the same memory resource, otherwise the bytes are
+			 * copied into this buffer's resource.
 			 * @param other Simple buffer to move from.
 			 * @return Reference to the updated simple buffer.
 			 */
-			Simple& operator=(Simple&& other) noexcept								= default;
+			Simple& operator=(Simple&& other)										= default;
 
 			/**
 			 * @brief Appends a byte vector to the current simple buffer
@@ -161,8 +196,7 @@ namespace StormByte::Buffers {
 			 */
 			template <typename NumericType, typename = std::enable_if_t<std::is_arithmetic_v<std::decay_t<NumericType>>>>
 			Simple& operator<<(const NumericType& value) {
-				const auto* raw_data = reinterpret_cast<const std::byte*>(&value);
-				m_data.insert(m_data.end(), raw_data, raw_data + sizeof(NumericType));
+				Append(reinterpret_cast<const std::byte*>(&value), sizeof(NumericType));
 				return *this;
 			}
 
@@ -213,8 +247,9 @@ namespace StormByte::Buffers {
 			 * @param length The number of bytes to discard.
 			 * @param mode The mode to use for discarding (default is `Read::Position::Relative`).
 			 * @note If the specified length exceeds the buffer size, the entire buffer is discarded.
+			 * @note Discarding bytes that are neither at the front nor at the end of shared storage copies it first.
 			 */
-			virtual void 															Discard(const std::size_t& length, const Read::Position& mode = Read::Position::Relative) noexcept;
+			virtual void 															Discard(const std::size_t& length, const Read::Position& mode = Read::Position::Relative);
 
 			/**
 			 * @brief Checks if the simple buffer is empty
@@ -230,6 +265,9 @@ namespace StormByte::Buffers {
 
 			/**
 			 * @brief Extracts a specific size of data, taking ownership of the read data and removing it from the simple buffer.
+			 *
+			 * Extracting the whole buffer from the start hands over the underlying storage without copying.
+			 *
 			 * @param length Length of the data to read and remove from the simple buffer.
 			 * @return `ExpectedDataType` containing the requested data, or an `Unexpected` with a `BufferOverflow` error if
 			 *         insufficient data exists.
@@ -242,7 +280,9 @@ namespace StormByte::Buffers {
 			 * Thread-safe version of @see Extract.
 			 * This function is a more efficient alternative to `Extract`, as it avoids copying data
 			 * by moving it directly into the target buffer. The read position is advanced by the
-			 * specified length.
+			 * specified length. Extracting the whole buffer into one holding nothing hands the
+			 * storage over without copying any byte,
+			 * provided both buffers use the same memory resource.
 			 * 
 			 * @param length Length of the data to extract.
 			 * @param output Buffer where the extracted data will be moved.
@@ -250,6 +290,22 @@ namespace StormByte::Buffers {
 			 */
 			virtual Read::Status 													ExtractInto(const size_t& length, Simple& output) noexcept;
 
+			/**
+			 * @brief Finds the first occurrence of a byte in the unread data.
+			 * @param value Byte to find.
+			 * @return Offset of the byte from the read position, or `std::nullopt` if it is not stored.
+			 * @see Search::Find
+			 */
+			virtual std::optional<std::size_t> 										Find(const Byte& value) const;
+
+			/**
+			 * @brief Finds the first occurrence of a byte sequence in the unread data.
+			 * @param pattern Sequence to find.
+			 * @return Offset of the sequence from the read position, or `std::nullopt` if it is not stored.
+			 * @see Search::Find
+			 */
+			virtual std::optional<std::size_t> 										Find(const ConstByteSpan& pattern) const;
+
 			/**
 			 * @brief Checks if the simple buffer has enough data starting from the current read position.
 			 * @param length Length of the data to check.
@@ -265,9 +321,41 @@ namespace StormByte::Buffers {
 			 *
 			 * @param column_size Number of bytes per column in the output. Defaults to 16.
 			 * @return Hexadecimal string representation of the stored value.
+			 * @see HexDump::Encode
 			 */
 			virtual std::string 													HexData(const std::size_t& column_size = 16) const;
 
+			/**
+			 * @brief Retrieves a range of the stored value as a hexadecimal string.
+			 * @param offset First byte of the range, counted from the start of the stored data.
+			 * @param length Number of bytes of the range, clamped to the stored data.
+			 * @param column_size Number of bytes per column in the output. Defaults to 16.
+			 * @return Hexadecimal string representation of the range.
+			 */
+			virtual std::string 													HexData(const std::size_t& offset, const std::size_t& length, const std::size_t& column_size = 16) const;
+
+			/**
+			 * @brief Streams a range of the stored value as hexadecimal to an output stream.
+			 *
+			 * The dump is produced in chunks, so large buffers do not need a full size temporary string.
+			 *
+			 * @param output Stream receiving the dump.
+			 * @param offset First byte of the range, counted from the start of the stored data.
+			 * @param length Number of bytes of the range, clamped to the stored data. Defaults to everything.
+			 * @param column_size Number of bytes per column in the output. Defaults to 16.
+			 */
+			virtual void 															HexData(std::ostream& output, const std::size_t& offset = 0, const std::size_t& length = std::numeric_limits<std::size_t>::max(), const std::size_t& column_size = 16) const;
+
+			/**
+			 * @brief Streams a range of the stored value as hexadecimal to a producer.
+			 * @param output Producer receiving the dump in chunks.
+			 * @param offset First byte of the range, counted from the start of the stored data.
+			 * @param length Number of bytes of the range, clamped to the stored data. Defaults to everything.
+			 * @param column_size Number of bytes per column in the output. Defaults to 16.
+			 * @return `Write::Status::Success`, or the first failed write status.
+			 */
+			virtual Write::Status 													HexData(Producer& output, const std::size_t& offset = 0, const std::size_t& length = std::numeric_limits<std::size_t>::max(), const std::size_t& column_size = 16) const;
+
 			/**
 			 * @brief Checks if the buffer is at the end of the file/data
 			 * @return True if the buffer is at the end, false otherwise.
@@ -286,6 +374,35 @@ namespace StormByte::Buffers {
 			 */
 			virtual ExpectedByte<BufferOverflow>									Peek() const;
 
+			/**
+			 * @brief Decodes a numeric value at the read position without advancing it.
+			 *
+			 * The value is decoded straight from the buffer storage after a single bounds check.
+			 *
+			 * @tparam T Arithmetic or enumeration type of 1, 2, 4 or 8 bytes.
+			 * @param endian Byte order of the stored value. Defaults to the host byte order, as written by `operator<<`.
+			 * @return The decoded value, or an `Unexpected` with a `BufferOverflow` error if insufficient data exists.
+			 */
+			template<Binary::Numeric T>
+			Expected<T, BufferOverflow> 											PeekAs(const std::endian& endian = std::endian::native) const {
+				Byte bytes[sizeof(T)];
+				if (Fetch(ByteSpan(bytes, sizeof(T)), false) != Read::Status::Success) {
+					return StormByte::Unexpected<BufferOverflow>("Insufficient data to peek {} bytes", sizeof(T));
+				}
+				return Binary::Load<T>(bytes, endian);
+			}
+
+			/**
+			 * @brief Retrieves a non-owning view of the next bytes without advancing the read position.
+			 *
+			 * Zero-copy, multi-byte counterpart of @see Peek. Lifetime rules are the same as @see ReadView.
+			 *
+			 * @param length Number of bytes to view.
+			 * @return `ExpectedConstByteSpan` with the requested bytes, or an `Unexpected` with a
+			 *         `BufferOverflow` error if insufficient data exists.
+			 */
+			ExpectedConstByteSpan<BufferOverflow> 									PeekView(const std::size_t& length) const;
+
 			/**
 			 * @brief Retrieves the read position
 			 * @return Current read position in the simple buffer.
@@ -324,6 +441,110 @@ namespace StormByte::Buffers {
 			 */
 			virtual ExpectedData<BufferOverflow> 									Read(const size_t& length) const;
 
+			/**
+			 * @brief Decodes a numeric value at the read position and advances past it.
+			 * @tparam T Arithmetic or enumeration type of 1, 2, 4 or 8 bytes.
+			 * @param endian Byte order of the stored value. Defaults to the host byte order, as written by `operator<<`.
+			 * @return The decoded value, or an `Unexpected` with a `BufferOverflow` error if insufficient data exists.
+			 * @see PeekAs
+			 */
+			template<Binary::Numeric T>
+			Expected<T, BufferOverflow> 											ReadAs(const std::endian& endian = std::endian::native) const {
+				Byte bytes[sizeof(T)];
+				if (Fetch(ByteSpan(bytes, sizeof(T)), true) != Read::Status::Success) {
+					return StormByte::Unexpected<BufferOverflow>("Insufficient data to read {} bytes", sizeof(T));
+				}
+				return Binary::Load<T>(bytes, endian);
+			}
+
+			/**
+			 * @brief Decodes a LEB128 varint at the read position and advances past it.
+			 *
+			 * Signed types use the sign extended LEB128 variant. A value that does not fit in `T`
+			 * is reported as an error after being consumed.
+			 *
+			 * @tparam T Integral type to decode.
+			 * @return The decoded value, or an `Unexpected` with a `BufferOverflow` error if the varint is
+			 *         incomplete, malformed or out of range for `T`.
+			 */
+			template<std::integral T>
+			Expected<T, BufferOverflow> 											ReadVarint() const {
+				auto bits = FetchVarint(std::is_signed_v<T>);
+				if (!bits) {
+					return StormByte::Unexpected(bits.error());
+				}
+				if constexpr (std::is_signed_v<T>) {
+					const auto value = static_cast<std::int64_t>(*bits);
+					if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max()) {
+						return StormByte::Unexpected<BufferOverflow>("Varint value {} does not fit in {} bytes", value, sizeof(T));
+					}
+					return static_cast<T>(value);
+				} else {
+					if (*bits > std::numeric_limits<T>::max()) {
+						return StormByte::Unexpected<BufferOverflow>("Varint value {} does not fit in {} bytes", *bits, sizeof(T));
+					}
+					return static_cast<T>(*bits);
+				}
+			}
+
+			/**
+			 * @brief Retrieves a non-owning view of the next bytes and advances the read position.
+			 *
+			 * Zero-copy counterpart of @see Read. The returned span points into the buffer storage.
+			 *
+			 * **Lifetime:** the span stays valid until the buffer is modified or destroyed. Any write,
+			 * extraction, discard, clear or reservation may move the storage and invalidates it.
+			 * Seeking or reading further does not.
+			 *
+			 * @param length Number of bytes to view.
+			 * @return `ExpectedConstByteSpan` with the requested bytes, or an `Unexpected` with a
+			 *         `BufferOverflow` error if insufficient data exists.
+			 */
+			ExpectedConstByteSpan<BufferOverflow> 									ReadView(const std::size_t& length) const;
+
+			/**
+			 * @brief Reads from a file descriptor directly into the buffer storage.
+			 *
+			 * Grows the storage by up to `max` bytes and fills it with a single `readv` call, so no
+			 * temporary buffer is involved. Read bytes are appended at the end of the buffer.
+			 *
+			 * @param fd File descriptor to read from.
+			 * @param max Maximum number of bytes to read.
+			 * @return Number of bytes read (0 at end of file), or a `BufferIOError` on failure.
+			 */
+			virtual Expected<std::size_t, BufferIOError> 							ReadFrom(const int& fd, const std::size_t& max);
+
+			/**
+			 * @brief Reads a line and advances past its terminator.
+			 * @return The line without its `\n` or `\r\n` terminator, or an `Unexpected` with a
+			 *         `BufferOverflow` error if no terminator is stored (nothing is consumed then).
+			 */
+			Expected<std::string, BufferOverflow> 									ReadLine() const;
+
+			/**
+			 * @brief Reads the data before a delimiter and advances past the delimiter.
+			 * @param delimiter Byte ending the data.
+			 * @return The data without the delimiter, or an `Unexpected` with a `BufferOverflow` error if the
+			 *         delimiter is not stored (nothing is consumed then).
+			 */
+			ExpectedData<BufferOverflow> 											ReadUntil(const Byte& delimiter) const;
+
+			/**
+			 * @brief Reads the data before a delimiter sequence and advances past the delimiter.
+			 * @param delimiter Sequence ending the data.
+			 * @return The data without the delimiter, or an `Unexpected` with a `BufferOverflow` error if the
+			 *         delimiter is not stored (nothing is consumed then).
+			 */
+			ExpectedData<BufferOverflow> 											ReadUntil(const ConstByteSpan& delimiter) const;
+
+			/**
+			 * @brief Reads the data before a delimiter string and advances past the delimiter.
+			 * @param delimiter String ending the data.
+			 * @return The data without the delimiter, or an `Unexpected` with a `BufferOverflow` error if the
+			 *         delimiter is not stored (nothing is consumed then).
+			 */
+			ExpectedData<BufferOverflow> 											ReadUntil(const std::string& delimiter) const;
+
 			/**
 			 * @brief Reserves simple buffer size
 			 * Ensures the simple buffer has enough capacity for the specified size.
@@ -344,6 +565,19 @@ namespace StormByte::Buffers {
 			 */
 			virtual std::size_t 													Size() const noexcept;
 
+			/**
+			 * @brief Creates a buffer holding a range of the stored data without copying it.
+			 *
+			 * The slice shares the heap storage of this buffer (small contents are copied) and either side
+			 * copies its bytes only when it is modified, so a slice stays valid after this buffer changes.
+			 *
+			 * @param offset First byte of the slice, counted from the start of the stored data.
+			 * @param length Number of bytes of the slice.
+			 * @return The slice with its read position at 0, or an `Unexpected` with a `BufferOverflow`
+			 *         error if the range exceeds the stored data.
+			 */
+			Expected<Simple, BufferOverflow> 										Slice(const std::size_t& offset, const std::size_t& length) const;
+
 			/**
 			 * @brief Retrieves a const view (span) to the stored value.
 			 * 
@@ -360,13 +594,16 @@ namespace StormByte::Buffers {
 			 * @brief Retrieves a view (span) to the stored value.
 			 * 
 			 * This method provides a lightweight, mutable view of the
-			 * buffer's contents without copying the data. The returned
-			 * span remains valid as long as the buffer is not modified.
+			 * buffer's contents. Storage shared with other buffers is
+			 * copied first so writes through the span stay private, use
+			 * the const overload (e.g. through `std::as_const`) to only
+			 * read. The returned span remains valid as long as the buffer
+			 * is not modified.
 			 * 
 			 * @return A mutable span of the stored value.
 			 * @note Modifying the buffer invalidates the returned span.
 			 */
-			std::span<Byte> 														Span() noexcept;
+			std::span<Byte> 														Span();
 
 			/**
 			 * @brief Writes a byte vector to the current simple buffer.
@@ -382,6 +619,7 @@ namespace StormByte::Buffers {
 			 * @brief Moves a byte vector and writes it to the current simple buffer.
 			 *
 			 * This function is provided for polymorphic use cases where `operator<<` cannot be used.
+			 * If the buffer is empty, the vector is adopted as the buffer storage without copying.
 			 *
 			 * @param data Byte vector to write.
 			 * @return Write::Status of the operation.
@@ -392,6 +630,7 @@ namespace StormByte::Buffers {
 			 * @brief Writes a simple buffer to the current simple buffer.
 			 *
 			 * This function is provided for polymorphic use cases where `operator<<` cannot be used.
+			 * If this buffer is empty, it shares the storage of `buffer` instead of copying it.
 			 *
 			 * @param buffer Simple buffer to write.
 			 * @return Write::Status of the operation.
@@ -418,9 +657,117 @@ namespace StormByte::Buffers {
 			 */
 			virtual Write::Status 													Write(const std::string& data);
 
+			/**
+			 * @brief Writes raw bytes to the current simple buffer.
+			 *
+			 * This function is provided for polymorphic use cases where `operator<<` cannot be used.
+			 *
+			 * @param data Bytes to write.
+			 * @return Write::Status of the operation.
+			 */
+			virtual Write::Status 													Write(const ConstByteSpan& data);
+
+			/**
+			 * @brief Encodes a numeric value with an explicit byte order and writes it.
+			 * @tparam T Arithmetic or enumeration type of 1, 2, 4 or 8 bytes.
+			 * @param value Value to write.
+			 * @param endian Byte order to store the value with. Defaults to the host byte order, as `operator<<`.
+			 * @return Write::Status of the operation.
+			 */
+			template<Binary::Numeric T>
+			Write::Status 															WriteAs(const T& value, const std::endian& endian = std::endian::native) {
+				Byte bytes[sizeof(T)];
+				Binary::Store(value, endian, bytes);
+				return Write(ConstByteSpan(bytes, sizeof(T)));
+			}
+
+			/**
+			 * @brief Writes the unread data to a file descriptor straight from the buffer storage.
+			 *
+			 * Partial writes are retried until everything is written, the descriptor would block or an
+			 * error occurs. Written bytes are removed from the buffer as with @see Extract, so calling
+			 * it repeatedly drains the buffer.
+			 *
+			 * @param fd File descriptor to write to.
+			 * @return Number of bytes written, or a `BufferIOError` if nothing could be written.
+			 */
+			virtual Expected<std::size_t, BufferIOError> 							WriteTo(const int& fd);
+
+			/**
+			 * @brief Encodes an integer as a LEB128 varint and writes it.
+			 *
+			 * Signed types use the sign extended LEB128 variant.
+			 *
+			 * @tparam T Integral type to encode.
+			 * @param value Value to write.
+			 * @return Write::Status of the operation.
+			 */
+			template<std::integral T>
+			Write::Status 															WriteVarint(const T& value) {
+				Byte bytes[Binary::MaxVarintSize];
+				const auto bits = static_cast<std::uint64_t>(static_cast<std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>(value));
+				return Write(ConstByteSpan(bytes, Binary::EncodeVarint(bits, std::is_signed_v<T>, bytes)));
+			}
+
 		protected:
-			std::vector<std::byte> m_data; 											///< Stored value.
+			Storage m_data; 														///< Stored value.
+			std::size_t m_head;														///< Offset of the first live byte in `m_data` (consumed prefix pending compaction).
 			mutable std::size_t m_position;											///< Read position.
 			mutable std::size_t m_minimum_chunk_size;								///< Minimum chunk size for buffer operations.
+			std::size_t m_appended;													///< Bytes appended by every write path over the buffer's life.
+
+			/**
+			 * @brief Appends raw bytes at the end of the buffer.
+			 *
+			 * Compacts the consumed prefix first when doing so avoids a reallocation.
+			 * This is the non-virtual primitive used by every write path.
+			 *
+			 * @param data Pointer to the bytes to append.
+			 * @param length Number of bytes to append.
+			 */
+			void 																	Append(const Byte* data, const std::size_t& length);
+
+			/**
+			 * @brief Physically removes the consumed prefix from the storage.
+			 *
+			 * Moves the live bytes to the front of `m_data` and resets `m_head`. Only the
+			 * live bytes are moved, and it is only triggered once the consumed prefix is at
+			 * least as large as them, so its cost is amortized over the consumed bytes.
+			 */
+			void 																	Compact() noexcept;
+
+			/**
+			 * @brief Copies the bytes at the read position, the primitive behind @see PeekAs and @see ReadAs.
+			 * @param output Destination, filled completely.
+			 * @param advance Whether to advance the read position past the copied bytes.
+			 * @return `Read::Status::Success`, or `Read::Status::Error` if insufficient data exists.
+			 */
+			virtual Read::Status 													Fetch(const ByteSpan& output, const bool& advance) const;
+
+			/**
+			 * @brief Decodes a LEB128 varint at the read position, the primitive behind @see ReadVarint.
+			 * @param is_signed Whether to decode the sign extended variant.
+			 * @return The decoded bits, or an `Unexpected` with a `BufferOverflow` error if the varint is incomplete or malformed.
+			 */
+			virtual Expected<std::uint64_t, BufferOverflow> 						FetchVarint(const bool& is_signed) const;
+
+			/**
+			 * @brief Reads the data before a delimiter, the primitive behind @see ReadUntil and @see ReadLine.
+			 * @param delimiter Non empty sequence ending the data, consumed but not returned.
+			 * @return The data, or an `Unexpected` with a `BufferOverflow` error if the delimiter is not stored.
+			 */
+			virtual ExpectedData<BufferOverflow> 									FetchUntil(const ConstByteSpan& delimiter) const;
+
+			/**
+			 * @brief Removes the live range `[start, end)`.
+			 *
+			 * Removing from the front only advances `m_head`. Removing from the middle moves
+			 * whichever side of the range is shorter, which copies the storage first if it is
+			 * shared. The read position is not modified.
+			 *
+			 * @param start First byte to remove, relative to the live data.
+			 * @param end One past the last byte to remove, relative to the live data.
+			 */
+			void 																	Remove(const std::size_t& start, const std::size_t& end);
 	};
 }
\ No newline at end of file
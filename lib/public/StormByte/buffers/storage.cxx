@@ -0,0 +1,299 @@
+#include <StormByte/buffers/storage.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+using namespace StormByte::Buffers;
+
+namespace {
+	// External bytes are read-only: storage referring to them is always shared, so it is detached into a
+	// vector before any of these visits
+	template<typename Heap, typename Function>
+	auto VisitVector(Heap& heap, Function&& function) {
+		using Result = decltype(function(std::get<Data>(heap)));
+		return std::visit([&](auto& bytes) -> Result {
+			if constexpr (std::is_same_v<std::remove_cvref_t<decltype(bytes)>, ConstByteSpan>) {
+				std::unreachable();
+			} else {
+				return function(bytes);
+			}
+		}, heap);
+	}
+}
+
+Storage::Storage(std::pmr::memory_resource* resource) noexcept:
+m_resource(resource), m_heap(), m_offset(0), m_size(0) {}
+
+Storage::Storage(const std::size_t& count, std::pmr::memory_resource* resource): Storage(resource) {
+	Resize(count);
+}
+
+Storage::Storage(const Byte* data, const std::size_t& length, std::pmr::memory_resource* resource): Storage(resource) {
+	Append(data, length);
+}
+
+Storage::Storage(Buffers::Data&& data): Storage() {
+	if (data.capacity() > 0) {
+		Adopt(std::move(data));
+	}
+}
+
+Storage::Storage(const ConstByteSpan& data, std::shared_ptr<const void> owner): Storage() {
+	if (data.empty()) {
+		return;
+	}
+	// The deleter holds the owner, keeping the bytes alive while any storage refers to them
+	m_heap = std::shared_ptr<Heap>(new Heap(std::in_place_type<ConstByteSpan>, data), [owner = std::move(owner)](Heap* heap) { delete heap; });
+	m_size = data.size();
+}
+
+Storage::Storage(const Storage& other) noexcept:
+m_resource(other.m_resource), m_heap(other.m_heap), m_offset(other.m_offset), m_size(other.m_size) {
+	if (!m_heap) {
+		std::memcpy(m_inline_data, other.m_inline_data, m_size);
+	}
+}
+
+Storage::Storage(Storage&& other) noexcept:
+m_resource(other.m_resource), m_heap(std::move(other.m_heap)), m_offset(other.m_offset), m_size(other.m_size) {
+	if (!m_heap) {
+		std::memcpy(m_inline_data, other.m_inline_data, m_size);
+	}
+	other.m_offset = 0;
+	other.m_size = 0;
+}
+
+Storage& Storage::operator=(const Storage& other) {
+	if (this == &other) {
+		return *this;
+	}
+	if (!other.m_heap || SameResource(other)) {
+		m_heap = other.m_heap;
+		m_offset = other.m_offset;
+		m_size = other.m_size;
+		if (!m_heap) {
+			std::memcpy(m_inline_data, other.m_inline_data, m_size);
+		}
+	} else {
+		// Memory of another resource must not end up owned by this one
+		Clear();
+		Append(other.Data(), other.m_size);
+	}
+	return *this;
+}
+
+Storage& Storage::operator=(Storage&& other) {
+	if (this == &other) {
+		return *this;
+	}
+	if (!other.m_heap || SameResource(other)) {
+		m_heap = std::move(other.m_heap);
+		m_offset = other.m_offset;
+		m_size = other.m_size;
+		if (!m_heap) {
+			std::memcpy(m_inline_data, other.m_inline_data, m_size);
+		}
+	} else {
+		Clear();
+		Append(other.Data(), other.m_size);
+		other.m_heap.reset();
+	}
+	other.m_offset = 0;
+	other.m_size = 0;
+	return *this;
+}
+
+void Storage::Append(const Byte* data, const std::size_t& length) {
+	if (length == 0) {
+		return;
+	}
+	if (!m_heap) {
+		if (m_size + length <= InlineCapacity) {
+			std::memcpy(m_inline_data + m_size, data, length);
+			m_size += length;
+			return;
+		}
+		Spill(std::max(m_size + length, 2 * InlineCapacity));
+	} else {
+		Detach(m_size + length);
+	}
+	VisitVector(*m_heap, [&](auto& bytes) { bytes.insert(bytes.end(), data, data + length); });
+	m_size += length;
+}
+
+void Storage::Adopt(Buffers::Data&& data) {
+	if (m_resource) {
+		// The vector was not allocated from the resource: copy it in
+		auto heap = MakeHeap(data.size());
+		std::get<pmr::Data>(*heap).assign(data.begin(), data.end());
+		m_heap = std::move(heap);
+	} else {
+		m_heap = std::make_shared<Heap>(std::in_place_type<Buffers::Data>, std::move(data));
+	}
+	m_size = VisitVector(*m_heap, [](const auto& bytes) { return bytes.size(); });
+	m_offset = 0;
+}
+
+void Storage::Consume(const std::size_t& length) noexcept {
+	if (length == 0) {
+		return;
+	}
+	if (!m_heap) {
+		std::memmove(m_inline_data, m_inline_data + length, m_size - length);
+	} else if (IsShared()) {
+		m_offset += length;
+	} else {
+		VisitVector(*m_heap, [&](auto& bytes) { bytes.erase(bytes.begin() + m_offset, bytes.begin() + m_offset + length); });
+	}
+	m_size -= length;
+}
+
+std::size_t Storage::Capacity() const noexcept {
+	if (!m_heap) {
+		return InlineCapacity;
+	}
+	return IsShared() ? m_size : VisitVector(*m_heap, [](const auto& bytes) { return bytes.capacity(); }) - m_offset;
+}
+
+void Storage::Clear() noexcept {
+	if (IsShared()) {
+		m_heap.reset();
+	} else if (m_heap) {
+		VisitVector(*m_heap, [](auto& bytes) { bytes.clear(); });
+	}
+	m_offset = 0;
+	m_size = 0;
+}
+
+void Storage::Erase(const std::size_t& first, const std::size_t& last) {
+	if (first >= last) {
+		return;
+	}
+	if (!m_heap) {
+		std::memmove(m_inline_data + first, m_inline_data + last, m_size - last);
+	} else if (IsShared() && (first == 0 || last == m_size)) {
+		// Narrow the window, the bytes stay untouched for the other owners
+		if (first == 0) {
+			m_offset += last;
+		}
+	} else {
+		Detach(m_size);
+		VisitVector(*m_heap, [&](auto& bytes) { bytes.erase(bytes.begin() + m_offset + first, bytes.begin() + m_offset + last); });
+	}
+	m_size -= last - first;
+}
+
+Byte* Storage::MutableData() {
+	if (!m_heap) {
+		return m_inline_data;
+	}
+	Detach(m_size);
+	return VisitVector(*m_heap, [](auto& bytes) { return bytes.data(); }) + m_offset;
+}
+
+StormByte::Buffers::Data Storage::Release() {
+	Buffers::Data data;
+	auto* owned = m_heap && !IsShared() && m_offset == 0 ? std::get_if<Buffers::Data>(m_heap.get()) : nullptr;
+	if (owned) {
+		owned->resize(m_size);
+		data = std::move(*owned);
+	} else {
+		data.assign(Data(), Data() + m_size);
+	}
+	m_heap.reset();
+	m_offset = 0;
+	m_size = 0;
+	return data;
+}
+
+void Storage::Reserve(const std::size_t& size) {
+	if (size <= Capacity()) {
+		return;
+	}
+	if (!m_heap) {
+		Spill(size);
+	} else {
+		Detach(size);
+		VisitVector(*m_heap, [&](auto& bytes) { bytes.reserve(m_offset + size); });
+	}
+}
+
+void Storage::Resize(const std::size_t& size) {
+	if (!m_heap && size <= InlineCapacity) {
+		if (size > m_size) {
+			std::memset(m_inline_data + m_size, 0, size - m_size);
+		}
+		m_size = size;
+		return;
+	}
+	if (IsShared() && size <= m_size) {
+		m_size = size;
+		return;
+	}
+	if (!m_heap) {
+		Spill(size);
+	} else {
+		Detach(size);
+	}
+	VisitVector(*m_heap, [&](auto& bytes) { bytes.resize(m_offset + size); });
+	m_size = size;
+}
+
+bool Storage::SameResource(const Storage& other) const noexcept {
+	if (!m_resource || !other.m_resource) {
+		return m_resource == other.m_resource;
+	}
+	return m_resource->is_equal(*other.m_resource);
+}
+
+Storage Storage::Slice(const std::size_t& first, const std::size_t& last) const noexcept {
+	Storage slice(m_resource);
+	if (m_heap) {
+		slice.m_heap = m_heap;
+		slice.m_offset = m_offset + first;
+	} else {
+		std::memcpy(slice.m_inline_data, m_inline_data + first, last - first);
+	}
+	slice.m_size = last - first;
+	return slice;
+}
+
+void Storage::Detach(const std::size_t& capacity) {
+	if (!IsShared()) {
+		// Pairs with the release done by the other owners when they dropped their reference
+		std::atomic_thread_fence(std::memory_order_acquire);
+		VisitVector(*m_heap, [&](auto& bytes) {
+			if (bytes.size() != m_offset + m_size) {
+				bytes.resize(m_offset + m_size);
+			}
+		});
+		return;
+	}
+	auto heap = MakeHeap(std::max(capacity, m_size));
+	const Byte* data = Data();
+	VisitVector(*heap, [&](auto& bytes) { bytes.assign(data, data + m_size); });
+	m_heap = std::move(heap);
+	m_offset = 0;
+}
+
+std::shared_ptr<Storage::Heap> Storage::MakeHeap(const std::size_t& capacity) const {
+	std::shared_ptr<Heap> heap;
+	if (m_resource) {
+		// The control block comes from the resource too
+		heap = std::allocate_shared<Heap>(std::pmr::polymorphic_allocator<Heap>(m_resource), std::in_place_type<pmr::Data>, m_resource);
+	} else {
+		heap = std::make_shared<Heap>(std::in_place_type<Buffers::Data>);
+	}
+	VisitVector(*heap, [&](auto& bytes) { bytes.reserve(capacity); });
+	return heap;
+}
+
+void Storage::Spill(const std::size_t& capacity) {
+	auto heap = MakeHeap(capacity);
+	VisitVector(*heap, [&](auto& bytes) { bytes.assign(m_inline_data, m_inline_data + m_size); });
+	m_heap = std::move(heap);
+	m_offset = 0;
+}
@@ -0,0 +1,294 @@
+#pragma once
+
+#include <StormByte/buffers/typedefs.hxx>
+#include <StormByte/visibility.h>
+
+#include <memory>
+#include <variant>
+
+/**
+ * @namespace Buffers
+ * @brief Namespace for buffer-related components in the StormByte library.
+ *
+ * The `StormByte::Buffers` namespace provides classes and utilities for managing simple, shared, and producer/consumer
+ * buffers in both single-threaded and multi-threaded environments. It supports a variety of use cases, including:
+ * - **Simple Buffers**: Lightweight, non-thread-safe buffers for single-threaded environments.
+ * - **Shared Buffers**: Flexible and efficient storage for byte data with concurrent access support.
+ * - **Producer/Consumer Buffers**: Advanced models for managing data flow between producers and consumers
+ *   with status tracking (e.g., `Ready`, `EoF`, `Error`).
+ * - **Thread Safety**: Shared and producer/consumer buffers are designed to ensure consistent behavior in multi-threaded environments.
+ */
+namespace StormByte::Buffers {
+	/**
+	 * @class Storage
+	 * @brief Contiguous byte storage with a small inline area and copy-on-write heap storage, used by `Simple`.
+	 *
+	 * Contents up to `InlineCapacity` bytes live inside the object itself; larger contents spill to a
+	 * reference counted vector. Once spilled, the heap storage is kept (like `std::vector` keeps its capacity)
+	 * until it is released. Without a memory resource the vector is a plain `Buffers::Data`, so byte vectors
+	 * are adopted and released without copying; with one it is a `pmr::Data` allocated from it.
+	 *
+	 * Heap storage may also refer to external bytes kept alive by their owner, such as a memory-mapped file.
+	 *
+	 * Copies and slices of heap storage share the same bytes in O(1); the first modification through any of
+	 * them copies its window into a private vector, so the others never observe it. Dropping bytes from either
+	 * end of shared storage only narrows the window and does not copy. Heap storage only moves between storages
+	 * using the same memory resource (see @see SameResource): assigning from any other copies the bytes, so a
+	 * storage keeps allocating from its own resource.
+	 *
+	 * Pointers returned by `Data` are invalidated by any modification and, while inline, by moving the object.
+	 */
+	class STORMBYTE_PUBLIC Storage final {
+		public:
+			static constexpr std::size_t InlineCapacity = 48;						///< Bytes stored without allocating.
+
+			/**
+			 * @brief Constructor
+			 * @param resource Memory resource used once the contents spill, null for the global allocator.
+			 */
+			explicit Storage(std::pmr::memory_resource* resource = nullptr) noexcept;
+
+			/**
+			 * @brief Constructor
+			 * @param count Number of zeroed bytes to store.
+			 * @param resource Memory resource used once the contents spill, null for the global allocator.
+			 */
+			Storage(const std::size_t& count, std::pmr::memory_resource* resource = nullptr);
+
+			/**
+			 * @brief Constructor
+			 * @param data Pointer to the bytes to copy.
+			 * @param length Number of bytes to copy.
+			 * @param resource Memory resource used once the contents spill, null for the global allocator.
+			 */
+			Storage(const Byte* data, const std::size_t& length, std::pmr::memory_resource* resource = nullptr);
+
+			/**
+			 * @brief Constructor
+			 * @param data Byte vector to adopt, the storage uses the global allocator.
+			 */
+			Storage(Buffers::Data&& data);
+
+			/**
+			 * @brief Constructor
+			 *
+			 * Refers to bytes owned by another object instead of copying them. They are never modified: the
+			 * storage is always considered shared, so the first modification copies its window.
+			 *
+			 * @param data Bytes to refer to.
+			 * @param owner Object keeping the bytes alive, released once no storage refers to them.
+			 */
+			Storage(const ConstByteSpan& data, std::shared_ptr<const void> owner);
+
+			/**
+			 * @brief Copy constructor
+			 * Heap contents are shared with `other` until either side modifies them; inline contents are copied.
+			 * @param other Storage to copy from.
+			 */
+			Storage(const Storage& other) noexcept;
+
+			/**
+			 * @brief Move constructor
+			 * @param other Storage to move from, left empty.
+			 */
+			Storage(Storage&& other) noexcept;
+
+			/**
+			 * @brief Destructor
+			 */
+			~Storage() noexcept 													= default;
+
+			/**
+			 * @brief Copy assignment operator
+			 * Shares the heap contents as @see Storage(const Storage&) does if both use the same memory
+			 * resource, copies them into this storage's resource otherwise.
+			 * @param other Storage to copy from.
+			 * @return Reference to the updated storage.
+			 */
+			Storage& operator=(const Storage& other);
+
+			/**
+			 * @brief Move assignment operator
+			 * Takes the heap contents if both use the same memory resource, copies them into this storage's
+			 * resource otherwise.
+			 * @param other Storage to move from, left empty.
+			 * @return Reference to the updated storage.
+			 */
+			Storage& operator=(Storage&& other);
+
+			/**
+			 * @brief Accesses a stored byte
+			 * @param index Index of the byte, must be lower than `Size()`.
+			 * @return Constant reference to the byte.
+			 */
+			inline const Byte& operator[](const std::size_t& index) const noexcept {
+				return Data()[index];
+			}
+
+			/**
+			 * @brief Appends bytes at the end
+			 * @param data Pointer to the bytes to append.
+			 * @param length Number of bytes to append.
+			 */
+			void 																	Append(const Byte* data, const std::size_t& length);
+
+			/**
+			 * @brief Replaces the contents with a byte vector
+			 * Its allocation is taken when this storage uses the global allocator, otherwise the bytes are
+			 * copied into the memory resource.
+			 * @param data Byte vector to adopt.
+			 */
+			void 																	Adopt(Buffers::Data&& data);
+
+			/**
+			 * @brief Retrieves the number of bytes that can be stored without allocating
+			 * @return Current capacity; the current size while the heap storage is shared.
+			 */
+			std::size_t 															Capacity() const noexcept;
+
+			/**
+			 * @brief Removes every byte, keeping the current allocation unless it is shared
+			 */
+			void 																	Clear() noexcept;
+
+			/**
+			 * @brief Retrieves a pointer to the first byte
+			 * @return Constant pointer to the stored bytes.
+			 */
+			inline const Byte* 														Data() const noexcept {
+				return m_heap ? std::visit([](const auto& bytes) { return bytes.data(); }, *m_heap) + m_offset : m_inline_data;
+			}
+
+			/**
+			 * @brief Removes the first bytes without allocating
+			 *
+			 * Shared storage narrows its window, owned storage moves the remaining bytes to the front.
+			 *
+			 * @param length Number of bytes to remove, at most @see Size.
+			 */
+			void 																	Consume(const std::size_t& length) noexcept;
+
+			/**
+			 * @brief Removes the range `[first, last)`, shifting the following bytes down
+			 *
+			 * Removing a prefix or a suffix of shared storage narrows the window without copying.
+			 *
+			 * @param first Index of the first byte to remove.
+			 * @param last Index one past the last byte to remove.
+			 */
+			void 																	Erase(const std::size_t& first, const std::size_t& last);
+
+			/**
+			 * @brief Checks if the contents are stored inline
+			 * @return True if no heap storage is in use.
+			 */
+			inline bool 															IsInline() const noexcept {
+				return !m_heap;
+			}
+
+			/**
+			 * @brief Checks if the heap storage is shared with another storage
+			 * @return True if a modification would copy the contents first, always the case for external bytes.
+			 */
+			inline bool 															IsShared() const noexcept {
+				return m_heap && (m_heap.use_count() > 1 || std::holds_alternative<ConstByteSpan>(*m_heap));
+			}
+
+			/**
+			 * @brief Retrieves a pointer to the first byte for modification
+			 *
+			 * Shared heap storage is copied first, so the returned bytes are only seen by this storage.
+			 *
+			 * @return Pointer to the stored bytes.
+			 */
+			Byte* 																	MutableData();
+
+			/**
+			 * @brief Moves the contents out as a byte vector and leaves the storage empty
+			 *
+			 * Exclusively owned contents of the global allocator are handed over without copying; any other
+			 * contents are copied into a new vector.
+			 *
+			 * @return The stored bytes.
+			 */
+			Buffers::Data 															Release();
+
+			/**
+			 * @brief Ensures room for at least `size` bytes
+			 * @param size Number of bytes to make room for.
+			 */
+			void 																	Reserve(const std::size_t& size);
+
+			/**
+			 * @brief Changes the number of stored bytes, zeroing the new ones
+			 * @param size New number of bytes.
+			 */
+			void 																	Resize(const std::size_t& size);
+
+			/**
+			 * @brief Retrieves the memory resource used for heap storage
+			 * @return Pointer to the memory resource, null for the global allocator.
+			 */
+			inline std::pmr::memory_resource* 										Resource() const noexcept {
+				return m_resource;
+			}
+
+			/**
+			 * @brief Checks if heap storage can move between this storage and `other` without copying
+			 * @param other Storage to compare with.
+			 * @return True if both use the global allocator or equal memory resources.
+			 */
+			bool 																	SameResource(const Storage& other) const noexcept;
+
+			/**
+			 * @brief Retrieves the number of stored bytes
+			 * @return Number of bytes.
+			 */
+			inline std::size_t 														Size() const noexcept {
+				return m_size;
+			}
+
+			/**
+			 * @brief Creates a storage holding the range `[first, last)`
+			 *
+			 * Heap contents are shared in O(1); inline contents are copied.
+			 *
+			 * @param first Index of the first byte, must not exceed `last`.
+			 * @param last Index one past the last byte, must not exceed `Size()`.
+			 * @return The new storage.
+			 */
+			Storage 																Slice(const std::size_t& first, const std::size_t& last) const noexcept;
+
+		private:
+			using Heap = std::variant<Buffers::Data, pmr::Data, ConstByteSpan>;	///< Heap vector: plain for the global allocator, allocator-aware for a memory resource, or external bytes.
+
+			std::pmr::memory_resource* m_resource;									///< Memory resource for heap storage, null for the global allocator.
+			std::shared_ptr<Heap> m_heap;											///< Heap storage, possibly shared (null while inline).
+			std::size_t m_offset;													///< First byte of this storage in `m_heap`.
+			std::size_t m_size;														///< Number of stored bytes.
+			alignas(std::max_align_t) Byte m_inline_data[InlineCapacity];			///< Inline storage.
+
+			/**
+			 * @brief Makes the heap storage exclusive before modifying it
+			 *
+			 * Shared storage is copied into a new vector; exclusive storage drops the bytes past the window
+			 * left over from former slices, so it can grow in place.
+			 *
+			 * @param capacity Minimum capacity of the window after detaching.
+			 */
+			void 																	Detach(const std::size_t& capacity);
+
+			/**
+			 * @brief Allocates an empty reference counted vector from the memory resource
+			 * @param capacity Capacity to reserve.
+			 * @return The vector.
+			 */
+			std::shared_ptr<Heap> 													MakeHeap(const std::size_t& capacity) const;
+
+			/**
+			 * @brief Moves the inline contents to the heap
+			 * @param capacity Minimum heap capacity to allocate.
+			 */
+			void 																	Spill(const std::size_t& capacity);
+	};
+}
\ No newline at end of file
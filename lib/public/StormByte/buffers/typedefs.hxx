@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <memory_resource>
 #include <span>
 #include <type_traits>
 #include <vector>
@@ -60,10 +61,12 @@ namespace StormByte::Buffers {
 		 * **Values:**
 		 * - `Success`: The read operation completed successfully.
 		 * - `Error`: The read operation encountered an error.
+		 * - `Timeout`: The read operation gave up waiting for data before its deadline.
 		 */
 		enum class Status: unsigned short {
 			Success, 				///< Indicates the read operation was successful.
-			Error    				///< Indicates an error occurred during the read operation.
+			Error,   				///< Indicates an error occurred during the read operation.
+			Timeout  				///< Indicates the read operation timed out waiting for data.
 		};
 	}
 
@@ -84,10 +87,12 @@ namespace StormByte::Buffers {
 		 * **Values:**
 		 * - `Success`: The write operation completed successfully.
 		 * - `Error`: The write operation encountered an error.
+		 * - `Timeout`: The write operation gave up waiting for room in a bounded buffer; nothing was written.
 		 */
 		enum class Status: unsigned short {
 			Success, ///< Indicates the write operation was successful.
-			Error    ///< Indicates the write operation encountered an error.
+			Error,   ///< Indicates the write operation encountered an error.
+			Timeout  ///< Indicates the write operation timed out before it could start.
 		};
 	}
 
@@ -115,6 +120,12 @@ namespace StormByte::Buffers {
 	 */
 	class Simple;
 
+	/**
+	 * @class Chained
+	 * @brief Forward declaration of the `Chained` class.
+	 */
+	class Chained;
+
 	/**
 	 * @class Shared
 	 * @brief Forward declaration of the `Shared` class.
@@ -155,6 +166,14 @@ namespace StormByte::Buffers {
 	using PipeFunction					= std::function<void(Consumer, Producer)>;				///< Represents a function that processes a data pipe.
 	using Processor						= std::function<std::shared_ptr<Simple>(const Simple&)>;///< Represents a function that processes a buffer.
 
+	/**
+	 * @namespace pmr
+	 * @brief Allocator-aware counterparts of the data types, like `std::pmr` for the standard containers.
+	 */
+	namespace pmr {
+		using Data						= std::pmr::vector<Byte>;								///< Represents a collection of bytes allocated from a `std::pmr::memory_resource` such as a `Pool`.
+	}
+
 	/**
 	 * @brief Wrapper for `operator<<` to support `std::shared_ptr` or `std::unique_ptr` as the left-hand parameter.
 	 *
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <StormByte/buffers/pipeline.hxx>
+#include <StormByte/buffers/producer.hxx>
+
+#include <algorithm>
+#include <string>
+
+namespace StormByte::Test {
+	inline Buffers::ConstByteSpan AsSpan(const std::string& text) {
+		return { reinterpret_cast<const std::byte*>(text.data()), text.size() };
+	}
+
+	inline std::string AsString(const Buffers::Data& data) {
+		return { reinterpret_cast<const char*>(data.data()), data.size() };
+	}
+
+	// Every byte value, derived from its offset so reordered or lost bytes are noticed
+	inline std::string Payload(const std::size_t& length, const std::size_t& offset = 0) {
+		std::string payload(length, '\0');
+		for (std::size_t i = 0; i < length; i++) {
+			payload[i] = static_cast<char>(((offset + i) * 131 + 7) & 0xFF);
+		}
+		return payload;
+	}
+
+	// Feeds `data` through `pipeline` and collects everything it outputs
+	inline std::string Run(Buffers::Pipeline& pipeline, const std::string& data, Buffers::Status& status) {
+		Buffers::Producer input;
+		input << data;
+		input << Buffers::Status::ReadOnly;
+		auto output = pipeline.Process(input.Consumer());
+		std::string result;
+		while (!output.IsEoF()) {
+			auto chunk = output.Extract(std::max<std::size_t>(output.AvailableBytes(), 1));
+			if (!chunk) {
+				break;
+			}
+			result += AsString(*chunk);
+		}
+		status = output.Status();
+		return result;
+	}
+}
@@ -0,0 +1,240 @@
+#include <StormByte/buffers/consumer.hxx>
+#include <StormByte/buffers/producer.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace StormByte;
+
+namespace {
+	Buffers::Async::Task Produce(Buffers::Producer producer, std::uint32_t records, std::atomic<int>& failures) {
+		for (std::uint32_t i = 0; i < records; i++) {
+			Buffers::Data data(sizeof(i));
+			std::memcpy(data.data(), &i, sizeof(i));
+			if (co_await producer.WriteAsync(std::move(data)) != Buffers::Write::Status::Success) {
+				failures++;
+				co_return;
+			}
+		}
+		producer << Buffers::Status::ReadOnly;
+	}
+
+	Buffers::Async::Task Consume(Buffers::Consumer consumer, std::uint32_t records, std::atomic<int>& failures) {
+		for (std::uint32_t i = 0; i < records; i++) {
+			auto data = co_await consumer.ExtractAsync(sizeof(i));
+			std::uint32_t value;
+			if (!data || (std::memcpy(&value, data->data(), sizeof(value)), value != i)) {
+				failures++;
+				co_return;
+			}
+		}
+		// Closed and drained: the awaitable completes with an error instead of suspending forever
+		if ((co_await consumer.ExtractAsync(1)).has_value()) {
+			failures++;
+		}
+	}
+
+	Buffers::Async::Task Receive(Buffers::Consumer consumer, std::atomic<int>& received) {
+		auto data = co_await consumer.ReadAsync(8);
+		if (data && data->size() == 8) {
+			received++;
+		}
+	}
+
+	// Coroutine started at once on the calling thread, so it is resumed inline instead of on an executor
+	struct Inline {
+		struct promise_type {
+			Inline get_return_object() noexcept { return {}; }
+			std::suspend_never initial_suspend() const noexcept { return {}; }
+			std::suspend_never final_suspend() const noexcept { return {}; }
+			void return_void() const noexcept {}
+			void unhandled_exception() const noexcept { std::terminate(); }
+		};
+	};
+
+	Inline WriteInline(Buffers::Producer producer, bool& written) {
+		written = co_await producer.WriteAsync(Buffers::Data(4, std::byte { 'w' })) == Buffers::Write::Status::Success;
+	}
+}
+
+int test_async_single_thread_pipe() {
+	// Producer and consumer share one thread: a full or empty buffer must suspend, never block
+	Buffers::Producer producer;
+	producer.Limit(64);
+	std::atomic<int> failures = 0;
+	{
+		Buffers::Async::Executor executor(1);
+		executor.Spawn(Consume(producer.Consumer(), 5000, failures));
+		executor.Spawn(Produce(producer, 5000, failures));
+		executor.Join();
+	}
+	ASSERT_EQUAL("test_async_single_thread_pipe", 0, failures.load());
+	ASSERT_EQUAL("test_async_single_thread_pipe", 0, producer.Consumer().AvailableBytes());
+	RETURN_TEST("test_async_single_thread_pipe", 0);
+}
+
+int test_async_many_streams() {
+	constexpr std::size_t streams = 2000;
+	std::vector<Buffers::Producer> producers(streams);
+	std::atomic<int> received = 0;
+	Buffers::Async::Executor executor(2);
+
+	// Every reader suspends on its empty buffer without holding a thread
+	for (auto& producer: producers) {
+		executor.Spawn(Receive(producer.Consumer(), received));
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	const auto start = std::chrono::steady_clock::now();
+	for (auto& producer: producers) {
+		producer << std::string("12345678");
+	}
+	executor.Join();
+	const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "Async streams: " << streams << " suspended streams resumed on 2 threads in " << elapsed * 1000 << " ms" << std::endl;
+	ASSERT_EQUAL("test_async_many_streams", static_cast<int>(streams), received.load());
+	RETURN_TEST("test_async_many_streams", 0);
+}
+
+int test_async_ready_and_closed() {
+	std::atomic<int> received = 0;
+	Buffers::Producer ready;
+	Buffers::Producer closed;
+	Buffers::Producer staged;
+	{
+		Buffers::Async::Executor executor(1);
+		// Data already there completes without suspending
+		ready << std::string("abcdefgh");
+		executor.Spawn(Receive(ready.Consumer(), received));
+		// A buffer closed with too little data completes with an error
+		executor.Spawn(Receive(closed.Consumer(), received));
+		closed << std::string("abc");
+		closed << Buffers::Status::ReadOnly;
+		executor.Join();
+	}
+	ASSERT_EQUAL("test_async_ready_and_closed", 1, received.load());
+	ASSERT_EQUAL("test_async_ready_and_closed", 3, closed.Consumer().AvailableBytes());
+
+	// Staged bytes are written ahead of the awaited write
+	staged.Coalesce(64);
+	staged << std::string("ab");
+	std::atomic<int> failures = 0;
+	{
+		Buffers::Async::Executor executor(1);
+		executor.Spawn([](Buffers::Producer& producer, std::atomic<int>& failures) -> Buffers::Async::Task {
+			Buffers::Data data(2, std::byte { 'c' });
+			if (co_await producer.WriteAsync(std::move(data)) != Buffers::Write::Status::Success) {
+				failures++;
+			}
+		}(staged, failures));
+		executor.Join();
+	}
+	ASSERT_EQUAL("test_async_ready_and_closed", 0, failures.load());
+	auto data = staged.Consumer().Read(4);
+	ASSERT_TRUE("test_async_ready_and_closed", data.has_value());
+	ASSERT_EQUAL("test_async_ready_and_closed", std::string("abcc"), std::string(reinterpret_cast<const char*>(data->data()), 4));
+	RETURN_TEST("test_async_ready_and_closed", 0);
+}
+
+int test_async_read_after_failed_attempt() {
+	auto shared = std::make_shared<Buffers::Shared>();
+	bool first = true;
+	// The bytes arrive between the failed read and the checks made after it
+	auto operation = Buffers::Async::ReadOperation(shared, 4, [&]() -> Buffers::ExpectedData<Buffers::BufferOverflow> {
+		if (std::exchange(first, false)) {
+			*shared << std::string("abcd");
+			return StormByte::Unexpected<Buffers::BufferOverflow>("Not there yet");
+		}
+		return shared->TryExtract(4);
+	});
+	auto result = operation();
+	ASSERT_TRUE("test_async_read_after_failed_attempt", result.has_value());
+	ASSERT_TRUE("test_async_read_after_failed_attempt", result->has_value());
+	ASSERT_EQUAL("test_async_read_after_failed_attempt", std::string("abcd"), std::string(reinterpret_cast<const char*>((*result)->data()), 4));
+
+	// Still missing while writable: wait, once closed without the bytes: fail
+	auto read = Buffers::Async::ReadOperation(shared, 4, [&] { return shared->TryRead(4); });
+	*shared << std::string("ab");
+	ASSERT_FALSE("test_async_read_after_failed_attempt", read().has_value());
+	*shared << Buffers::Status::ReadOnly;
+	result = read();
+	ASSERT_TRUE("test_async_read_after_failed_attempt", result.has_value());
+	ASSERT_FALSE("test_async_read_after_failed_attempt", result->has_value());
+	RETURN_TEST("test_async_read_after_failed_attempt", 0);
+}
+
+int test_async_write_retries_not_counted() {
+	Buffers::Producer producer;
+	producer.Limit(4);
+	producer << std::string("full");
+	std::atomic<int> failures = 0;
+	{
+		Buffers::Async::Executor executor(1);
+		executor.Spawn([](Buffers::Producer producer, std::atomic<int>& failures) -> Buffers::Async::Task {
+			for (int i = 0; i < 100; i++) {
+				if (co_await producer.WriteAsync(Buffers::Data(4, std::byte { 'w' })) != Buffers::Write::Status::Success) {
+					failures++;
+				}
+			}
+		}(producer, failures));
+		executor.Spawn([](Buffers::Consumer consumer, std::atomic<int>& failures) -> Buffers::Async::Task {
+			for (int i = 0; i < 101; i++) {
+				if (!(co_await consumer.ExtractAsync(4))) {
+					failures++;
+				}
+			}
+		}(producer.Consumer(), failures));
+		executor.Join();
+	}
+	ASSERT_EQUAL("test_async_write_retries_not_counted", 0, failures.load());
+	// Awaited writes suspend instead of blocking, none is a blocked write nor a timeout
+	const auto stats = producer.Stats();
+	ASSERT_EQUAL("test_async_write_retries_not_counted", 0, stats.blocked_writes);
+	ASSERT_EQUAL("test_async_write_retries_not_counted", 0, stats.write_timeouts);
+	RETURN_TEST("test_async_write_retries_not_counted", 0);
+}
+
+int test_async_inline_writer_read_view() {
+	Buffers::Producer producer;
+	producer.Limit(4);
+	auto consumer = producer.Consumer();
+	producer << std::string("full");
+	bool written = false;
+	WriteInline(producer, written);
+	ASSERT_FALSE("test_async_inline_writer_read_view", written);
+
+	// The parked writer retries on this thread, which must not hold the view's lock by then
+	{
+		auto view = consumer.ReadView(4);
+		ASSERT_TRUE("test_async_inline_writer_read_view", view.has_value());
+		ASSERT_FALSE("test_async_inline_writer_read_view", written);
+	}
+	ASSERT_TRUE("test_async_inline_writer_read_view", written);
+	ASSERT_EQUAL("test_async_inline_writer_read_view", 4, consumer.AvailableBytes());
+	RETURN_TEST("test_async_inline_writer_read_view", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_async_single_thread_pipe();
+	result += test_async_many_streams();
+	result += test_async_ready_and_closed();
+	result += test_async_read_after_failed_attempt();
+	result += test_async_write_retries_not_counted();
+	result += test_async_inline_writer_read_view();
+
+	if (result == 0) {
+		std::cout << "All tests passed!" << std::endl;
+	} else {
+		std::cout << result << " tests failed." << std::endl;
+	}
+
+	return result;
+}
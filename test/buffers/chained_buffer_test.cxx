@@ -0,0 +1,140 @@
+#include <StormByte/buffers/chained.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <iostream>
+
+using namespace StormByte;
+
+namespace {
+	Buffers::Data MakeData(const std::string& text) {
+		return Buffers::Data(reinterpret_cast<const std::byte*>(text.data()),
+							reinterpret_cast<const std::byte*>(text.data()) + text.size());
+	}
+
+	std::string ToString(const Buffers::Data& data) {
+		return std::string(reinterpret_cast<const char*>(data.data()), data.size());
+	}
+}
+
+int test_chained_adopts_segments() {
+	Buffers::Chained buffer;
+	std::string first(2048, 'A'), second(4096, 'B');
+	auto first_data = MakeData(first);
+	const auto* first_address = first_data.data();
+	buffer << std::move(first_data) << MakeData(second);
+
+	ASSERT_EQUAL("test_chained_adopts_segments", 2, buffer.Segments());
+	ASSERT_EQUAL("test_chained_adopts_segments", first.size() + second.size(), buffer.Size());
+
+	// Extracting exactly the first segment hands over the original storage
+	auto extracted = buffer.Extract(first.size());
+	ASSERT_TRUE("test_chained_adopts_segments", extracted.has_value());
+	ASSERT_TRUE("test_chained_adopts_segments", first_address == extracted->data());
+	ASSERT_EQUAL("test_chained_adopts_segments", first, ToString(*extracted));
+	ASSERT_EQUAL("test_chained_adopts_segments", second, ToString(buffer.Data()));
+
+	RETURN_TEST("test_chained_adopts_segments", 0);
+}
+
+int test_chained_coalesces_small_writes() {
+	Buffers::Chained buffer;
+	for (int i = 0; i < 100; ++i) {
+		buffer << std::string("abc");
+	}
+	buffer << 42;
+	ASSERT_EQUAL("test_chained_coalesces_small_writes", 1, buffer.Segments());
+	ASSERT_EQUAL("test_chained_coalesces_small_writes", 300 + sizeof(int), buffer.Size());
+	RETURN_TEST("test_chained_coalesces_small_writes", 0);
+}
+
+int test_chained_read_across_segments() {
+	Buffers::Chained buffer;
+	std::string first(1500, 'x'), second(1500, 'y');
+	buffer << MakeData(first) << MakeData(second);
+
+	buffer.Seek(1498, Buffers::Read::Position::Begin);
+	auto peeked = buffer.Peek();
+	ASSERT_TRUE("test_chained_read_across_segments", peeked.has_value());
+	ASSERT_EQUAL("test_chained_read_across_segments", 'x', static_cast<char>(peeked.value()));
+
+	auto read = buffer.Read(4);
+	ASSERT_TRUE("test_chained_read_across_segments", read.has_value());
+	ASSERT_EQUAL("test_chained_read_across_segments", "xxyy", ToString(*read));
+	ASSERT_EQUAL("test_chained_read_across_segments", 1502, buffer.Position());
+
+	buffer.Seek(-2, Buffers::Read::Position::End);
+	ASSERT_EQUAL("test_chained_read_across_segments", 2, buffer.AvailableBytes());
+	ASSERT_FALSE("test_chained_read_across_segments", buffer.Read(3).has_value());
+
+	RETURN_TEST("test_chained_read_across_segments", 0);
+}
+
+int test_chained_discard_and_extract() {
+	Buffers::Chained buffer;
+	buffer << MakeData(std::string(1024, '1')) << MakeData(std::string(1024, '2')) << MakeData(std::string(1024, '3'));
+
+	// Discard across a segment boundary from the middle
+	buffer.Seek(1000, Buffers::Read::Position::Begin);
+	buffer.Discard(1048, Buffers::Read::Position::Relative);
+	ASSERT_EQUAL("test_chained_discard_and_extract", 2024, buffer.Size());
+	ASSERT_EQUAL("test_chained_discard_and_extract", 1000, buffer.Position());
+	auto data = buffer.Data();
+	ASSERT_EQUAL("test_chained_discard_and_extract", std::string(1000, '1') + std::string(1024, '3'), ToString(data));
+
+	// Extract from the front advances through segments
+	buffer.Seek(0, Buffers::Read::Position::Begin);
+	auto head = buffer.Extract(1500);
+	ASSERT_TRUE("test_chained_discard_and_extract", head.has_value());
+	ASSERT_EQUAL("test_chained_discard_and_extract", std::string(1000, '1') + std::string(500, '3'), ToString(*head));
+	ASSERT_EQUAL("test_chained_discard_and_extract", std::string(524, '3'), ToString(buffer.Data()));
+
+	RETURN_TEST("test_chained_discard_and_extract", 0);
+}
+
+int test_chained_extract_into() {
+	Buffers::Chained source, target;
+	Buffers::Simple simple;
+	source << MakeData(std::string(2048, 'a')) << MakeData(std::string(2048, 'b'));
+
+	auto status = source.ExtractInto(3000, target);
+	ASSERT_TRUE("test_chained_extract_into", Buffers::Read::Status::Success == status);
+	ASSERT_EQUAL("test_chained_extract_into", 3000, target.Size());
+	ASSERT_EQUAL("test_chained_extract_into", 1096, source.Size());
+
+	status = source.ExtractInto(1096, simple);
+	ASSERT_TRUE("test_chained_extract_into", Buffers::Read::Status::Success == status);
+	ASSERT_TRUE("test_chained_extract_into", source.Empty());
+	ASSERT_EQUAL("test_chained_extract_into", std::string(1096, 'b'), ToString(simple.Data()));
+
+	auto span = target.Span();
+	ASSERT_EQUAL("test_chained_extract_into", 1, target.Segments());
+	ASSERT_EQUAL("test_chained_extract_into", std::string(2048, 'a') + std::string(952, 'b'),
+		std::string(reinterpret_cast<const char*>(span.data()), span.size()));
+
+	RETURN_TEST("test_chained_extract_into", 0);
+}
+
+int test_chained_hexdata_matches_simple() {
+	Buffers::Chained chained;
+	chained << MakeData(std::string(1030, 'z')) << std::string("Hello");
+	Buffers::Simple simple(chained.Data());
+	ASSERT_EQUAL("test_chained_hexdata_matches_simple", simple.HexData(), chained.HexData());
+	RETURN_TEST("test_chained_hexdata_matches_simple", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_chained_adopts_segments();
+	result += test_chained_coalesces_small_writes();
+	result += test_chained_read_across_segments();
+	result += test_chained_discard_and_extract();
+	result += test_chained_extract_into();
+	result += test_chained_hexdata_matches_simple();
+
+	if (result == 0) {
+		std::cout << "All tests passed!" << std::endl;
+	} else {
+		std::cout << result << " tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
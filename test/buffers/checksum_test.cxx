@@ -0,0 +1,97 @@
+#include <StormByte/buffers/checksum.hxx>
+#include <StormByte/buffers/pipeline.hxx>
+#include <StormByte/test_buffers.h>
+#include <StormByte/test_handlers.h>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+using namespace StormByte;
+using namespace StormByte::Test;
+
+int test_crc32c_known_values() {
+	ASSERT_EQUAL("test_crc32c_known_values", 0u, Buffers::Checksum::CRC32C(AsSpan("")));
+	ASSERT_EQUAL("test_crc32c_known_values", 0xE3069283u, Buffers::Checksum::CRC32C(AsSpan("123456789")));
+	ASSERT_EQUAL("test_crc32c_known_values", 0x22620404u, Buffers::Checksum::CRC32C(AsSpan("The quick brown fox jumps over the lazy dog")));
+
+	// Chaining gives the same result whatever the split
+	const auto payload = Payload(1000);
+	const auto whole = Buffers::Checksum::CRC32C(AsSpan(payload));
+	for (std::size_t split : { 0, 1, 7, 8, 9, 500, 999, 1000 }) {
+		const auto first = Buffers::Checksum::CRC32C(AsSpan(payload).first(split));
+		ASSERT_EQUAL("test_crc32c_known_values", whole, Buffers::Checksum::CRC32C(AsSpan(payload).subspan(split), first));
+	}
+
+	Buffers::Simple buffer(payload.data(), payload.size());
+	(void)buffer.Read(100);
+	ASSERT_EQUAL("test_crc32c_known_values", Buffers::Checksum::CRC32C(AsSpan(payload).subspan(100)), Buffers::Checksum::CRC32C(buffer));
+	RETURN_TEST("test_crc32c_known_values", 0);
+}
+
+int test_hash_known_values() {
+	ASSERT_EQUAL("test_hash_known_values", 0xEF46DB3751D8E999ull, Buffers::Checksum::Hash(AsSpan("")));
+	ASSERT_EQUAL("test_hash_known_values", 0x44BC2CF5AD770999ull, Buffers::Checksum::Hash(AsSpan("abc")));
+	ASSERT_EQUAL("test_hash_known_values", 0x0B242D361FDA71BCull, Buffers::Checksum::Hash(AsSpan("The quick brown fox jumps over the lazy dog")));
+	RETURN_TEST("test_hash_known_values", 0);
+}
+
+int test_hash_incremental() {
+	const auto payload = Payload(1000);
+	for (std::uint64_t seed : { 0ull, 42ull }) {
+		const auto whole = Buffers::Checksum::Hash(AsSpan(payload), seed);
+		for (std::size_t step : { 1, 3, 31, 32, 33, 100 }) {
+			Buffers::Checksum::Hash64 hash(seed);
+			for (std::size_t offset = 0; offset < payload.size(); offset += step) {
+				hash.Update(AsSpan(payload).subspan(offset, std::min(step, payload.size() - offset)));
+			}
+			ASSERT_EQUAL("test_hash_incremental", whole, hash.Value());
+		}
+	}
+	RETURN_TEST("test_hash_incremental", 0);
+}
+
+int test_trailer_round_trip() {
+	const auto payload = Payload(5000);
+	for (auto algorithm : { Buffers::Checksum::Algorithm::CRC32C, Buffers::Checksum::Algorithm::Hash64 }) {
+		Buffers::Status status;
+
+		Buffers::Pipeline round_trip;
+		round_trip.AddPipe(Buffers::Checksum::AppendTrailer(algorithm));
+		round_trip.AddPipe(Buffers::Checksum::VerifyTrailer(algorithm));
+		ASSERT_EQUAL("test_trailer_round_trip", payload, Run(round_trip, payload, status));
+		ASSERT_TRUE("test_trailer_round_trip", status == Buffers::Status::ReadOnly);
+
+		Buffers::Pipeline append;
+		append.AddPipe(Buffers::Checksum::AppendTrailer(algorithm));
+		auto framed = Run(append, payload, status);
+		ASSERT_EQUAL("test_trailer_round_trip", payload.size() + (algorithm == Buffers::Checksum::Algorithm::CRC32C ? 4 : 8), framed.size());
+
+		// A flipped payload bit is reported as an error
+		framed[1234] ^= 0x10;
+		Buffers::Pipeline verify;
+		verify.AddPipe(Buffers::Checksum::VerifyTrailer(algorithm));
+		Run(verify, framed, status);
+		ASSERT_TRUE("test_trailer_round_trip", status == Buffers::Status::Error);
+
+		// So is a stream shorter than the trailer
+		Run(verify, "ab", status);
+		ASSERT_TRUE("test_trailer_round_trip", status == Buffers::Status::Error);
+	}
+	RETURN_TEST("test_trailer_round_trip", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_crc32c_known_values();
+	result += test_hash_known_values();
+	result += test_hash_incremental();
+	result += test_trailer_round_trip();
+
+	if (result == 0) {
+		std::cout << "All tests passed!" << std::endl;
+	} else {
+		std::cout << result << " tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include <StormByte/buffers/compression.hxx>
+#include <StormByte/buffers/pipeline.hxx>
+#include <StormByte/test_buffers.h>
+#include <StormByte/test_handlers.h>
+
+#include <iostream>
+#include <string>
+
+using namespace StormByte;
+using namespace StormByte::Test;
+
+namespace {
+	// Log-like text, the redundant kind of data pipelines write to disk
+	std::string Redundant(const std::size_t& length) {
+		std::string text;
+		for (std::size_t line = 0; text.size() < length; line++) {
+			text += "2025-01-01 12:00:" + std::to_string(line % 60) + " [INFO] worker " + std::to_string(line % 7) + " processed request " + std::to_string(line) + "\n";
+		}
+		text.resize(length);
+		return text;
+	}
+
+	// Noise from a linear congruential generator, practically incompressible
+	std::string Noise(const std::size_t& length) {
+		std::string text(length, '\0');
+		std::uint32_t state = 12345;
+		for (auto& c : text) {
+			state = state * 1103515245u + 12345u;
+			c = static_cast<char>(state >> 24);
+		}
+		return text;
+	}
+}
+
+int test_compress_round_trip() {
+	for (const auto& data : { std::string(), std::string("a"), std::string("abcabcabcabcabcabc"), std::string(1000, 'x'), Redundant(100000), Noise(100000) }) {
+		auto compressed = Buffers::Compression::Compress(AsSpan(data));
+		ASSERT_TRUE("test_compress_round_trip", compressed.size() <= Buffers::Compression::MaxCompressedSize(data.size()));
+		auto decompressed = Buffers::Compression::Decompress(Buffers::ConstByteSpan(compressed));
+		ASSERT_TRUE("test_compress_round_trip", decompressed.has_value());
+		ASSERT_EQUAL("test_compress_round_trip", data, AsString(*decompressed));
+	}
+
+	// Redundant data shrinks, the buffer overloads compress the unread part only
+	Buffers::Simple buffer(Redundant(100000));
+	(void)buffer.Read(1000);
+	auto compressed = Buffers::Compression::Compress(buffer);
+	ASSERT_TRUE("test_compress_round_trip", compressed.Size() < 25000);
+	auto decompressed = Buffers::Compression::Decompress(compressed);
+	ASSERT_TRUE("test_compress_round_trip", decompressed.has_value());
+	ASSERT_EQUAL("test_compress_round_trip", Redundant(100000).substr(1000), AsString(decompressed->Data()));
+	RETURN_TEST("test_compress_round_trip", 0);
+}
+
+int test_decompress_rejects_corruption() {
+	const auto data = Redundant(10000);
+	const auto compressed = Buffers::Compression::Compress(AsSpan(data));
+
+	// Every truncation is detected
+	for (std::size_t length = 0; length < compressed.size(); length++) {
+		ASSERT_FALSE("test_decompress_rejects_corruption", Buffers::Compression::Decompress(std::span(compressed).first(length)).has_value());
+	}
+
+	// Flipped bytes either fail or still decode to the declared size, never overrun
+	for (std::size_t position = 0; position < compressed.size(); position += 7) {
+		auto corrupted = compressed;
+		corrupted[position] ^= std::byte{0x5A};
+		auto decompressed = Buffers::Compression::Decompress(Buffers::ConstByteSpan(corrupted));
+		if (decompressed) {
+			ASSERT_EQUAL("test_decompress_rejects_corruption", data.size(), decompressed->size());
+		}
+	}
+
+	// A length header the payload can not expand to is rejected before allocating
+	const Buffers::Data bomb { std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0x0F}, std::byte{0x00} };
+	ASSERT_FALSE("test_decompress_rejects_corruption", Buffers::Compression::Decompress(Buffers::ConstByteSpan(bomb)).has_value());
+	RETURN_TEST("test_decompress_rejects_corruption", 0);
+}
+
+int test_compression_pipeline() {
+	const auto data = Redundant(3 * Buffers::Compression::BlockSize + 1234);
+	Buffers::Status status;
+
+	Buffers::Pipeline round_trip;
+	round_trip.AddPipe(Buffers::Compression::Compressor());
+	round_trip.AddPipe(Buffers::Compression::Decompressor());
+	ASSERT_EQUAL("test_compression_pipeline", data, Run(round_trip, data, status));
+	ASSERT_TRUE("test_compression_pipeline", status == Buffers::Status::ReadOnly);
+
+	Buffers::Pipeline compress;
+	compress.AddPipe(Buffers::Compression::Compressor());
+	auto framed = Run(compress, data, status);
+	ASSERT_TRUE("test_compression_pipeline", framed.size() < data.size() / 4);
+
+	// Truncated streams end in error
+	Buffers::Pipeline decompress;
+	decompress.AddPipe(Buffers::Compression::Decompressor());
+	Run(decompress, framed.substr(0, framed.size() - 1), status);
+	ASSERT_TRUE("test_compression_pipeline", status == Buffers::Status::Error);
+
+	// An empty stream is a valid empty result
+	ASSERT_EQUAL("test_compression_pipeline", std::string(), Run(round_trip, std::string(), status));
+	ASSERT_TRUE("test_compression_pipeline", status == Buffers::Status::ReadOnly);
+	RETURN_TEST("test_compression_pipeline", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_compress_round_trip();
+	result += test_decompress_rejects_corruption();
+	result += test_compression_pipeline();
+
+	if (result == 0) {
+		std::cout << "All tests passed!" << std::endl;
+	} else {
+		std::cout << result << " tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
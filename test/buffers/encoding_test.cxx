@@ -0,0 +1,186 @@
+#include <StormByte/buffers/base64.hxx>
+#include <StormByte/buffers/hex.hxx>
+#include <StormByte/buffers/pipeline.hxx>
+#include <StormByte/test_buffers.h>
+#include <StormByte/test_handlers.h>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+using namespace StormByte;
+using namespace StormByte::Test;
+
+int test_base64_known_values() {
+	using Buffers::Base64::Alphabet;
+	// RFC 4648 test vectors
+	const std::pair<std::string, std::string> vectors[] = {
+		{ "", "" }, { "f", "Zg==" }, { "fo", "Zm8=" }, { "foo", "Zm9v" },
+		{ "foob", "Zm9vYg==" }, { "fooba", "Zm9vYmE=" }, { "foobar", "Zm9vYmFy" }
+	};
+	for (const auto& [data, text] : vectors) {
+		ASSERT_EQUAL("test_base64_known_values", text, Buffers::Base64::Encode(AsSpan(data)));
+		auto decoded = Buffers::Base64::Decode(text);
+		ASSERT_TRUE("test_base64_known_values", decoded.has_value());
+		ASSERT_EQUAL("test_base64_known_values", data, AsString(*decoded));
+	}
+
+	// URL alphabet swaps the last two characters and decodes unpadded text
+	const std::string bytes = "\xFB\xFF\xBF";
+	ASSERT_EQUAL("test_base64_known_values", "+/+/", Buffers::Base64::Encode(AsSpan(bytes)));
+	ASSERT_EQUAL("test_base64_known_values", "-_-_", Buffers::Base64::Encode(AsSpan(bytes), Alphabet::URL));
+	ASSERT_EQUAL("test_base64_known_values", "Zm8", Buffers::Base64::Encode(AsSpan("fo"), Alphabet::URL, false));
+	auto unpadded = Buffers::Base64::Decode(std::string("Zm8"), Alphabet::URL);
+	ASSERT_TRUE("test_base64_known_values", unpadded.has_value());
+	ASSERT_EQUAL("test_base64_known_values", "fo", AsString(*unpadded));
+	RETURN_TEST("test_base64_known_values", 0);
+}
+
+int test_base64_round_trip() {
+	using Buffers::Base64::Alphabet;
+	for (const auto alphabet : { Alphabet::Standard, Alphabet::URL }) {
+		for (const bool padding : { true, false }) {
+			for (std::size_t length : { 1, 2, 3, 11, 12, 13, 15, 16, 17, 47, 48, 49, 100, 1000, 4099 }) {
+				const auto data = Payload(length);
+				const auto text = Buffers::Base64::Encode(AsSpan(data), alphabet, padding);
+				ASSERT_EQUAL("test_base64_round_trip", Buffers::Base64::EncodedSize(length, padding), text.size());
+				auto decoded = Buffers::Base64::Decode(text, alphabet);
+				ASSERT_TRUE("test_base64_round_trip", decoded.has_value());
+				ASSERT_EQUAL("test_base64_round_trip", data, AsString(*decoded));
+			}
+		}
+	}
+
+	// Buffer overloads append encoded text and decode the unread part only
+	const auto data = Payload(300);
+	Buffers::Simple buffer("prefix", 6);
+	ASSERT_TRUE("test_base64_round_trip", Buffers::Base64::Encode(AsSpan(data), buffer) == Buffers::Write::Status::Success);
+	(void)buffer.Read(6);
+	auto decoded = Buffers::Base64::Decode(buffer);
+	ASSERT_TRUE("test_base64_round_trip", decoded.has_value());
+	ASSERT_EQUAL("test_base64_round_trip", data, AsString(decoded->Data()));
+	RETURN_TEST("test_base64_round_trip", 0);
+}
+
+int test_base64_rejects_invalid() {
+	using Buffers::Base64::Alphabet;
+	const auto text = Buffers::Base64::Encode(AsSpan(Payload(200)));
+
+	// A bad character anywhere, including inside the vector loop, is reported at its offset
+	for (std::size_t position : { 0, 5, 17, 100, 199, 263 }) {
+		for (const char bad : { '!', ' ', '\n', '=', '-', '\x80' }) {
+			auto corrupted = text;
+			corrupted[position] = bad;
+			auto decoded = Buffers::Base64::Decode(corrupted);
+			ASSERT_FALSE("test_base64_rejects_invalid", decoded.has_value());
+			ASSERT_TRUE("test_base64_rejects_invalid", std::string(decoded.error()->what()).find(std::to_string(position)) != std::string::npos);
+		}
+	}
+
+	ASSERT_FALSE("test_base64_rejects_invalid", Buffers::Base64::Decode(std::string("Zm9vY")).has_value());
+	ASSERT_FALSE("test_base64_rejects_invalid", Buffers::Base64::Decode(std::string("Zm9=")).has_value());
+	ASSERT_FALSE("test_base64_rejects_invalid", Buffers::Base64::Decode(std::string("Zm=v")).has_value());
+	ASSERT_FALSE("test_base64_rejects_invalid", Buffers::Base64::Decode(std::string("Zg=")).has_value());
+	ASSERT_FALSE("test_base64_rejects_invalid", Buffers::Base64::Decode(std::string("Zh==")).has_value());
+	ASSERT_FALSE("test_base64_rejects_invalid", Buffers::Base64::Decode(std::string("+/+/"), Alphabet::URL).has_value());
+	ASSERT_FALSE("test_base64_rejects_invalid", Buffers::Base64::Decode(std::string("-_-_")).has_value());
+	RETURN_TEST("test_base64_rejects_invalid", 0);
+}
+
+int test_hex_round_trip() {
+	ASSERT_EQUAL("test_hex_round_trip", "00FF7F10", Buffers::Hex::Encode(AsSpan(std::string("\x00\xFF\x7F\x10", 4))));
+	for (std::size_t length : { 0, 1, 15, 16, 17, 31, 32, 33, 1000 }) {
+		const auto data = Payload(length);
+		const auto text = Buffers::Hex::Encode(AsSpan(data));
+		ASSERT_EQUAL("test_hex_round_trip", 2 * length, text.size());
+		auto decoded = Buffers::Hex::Decode(text);
+		ASSERT_TRUE("test_hex_round_trip", decoded.has_value());
+		ASSERT_EQUAL("test_hex_round_trip", data, AsString(*decoded));
+
+		// Lower case digits decode the same
+		std::string lower = text;
+		std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		decoded = Buffers::Hex::Decode(lower);
+		ASSERT_TRUE("test_hex_round_trip", decoded.has_value());
+		ASSERT_EQUAL("test_hex_round_trip", data, AsString(*decoded));
+	}
+
+	Buffers::Simple buffer;
+	ASSERT_TRUE("test_hex_round_trip", Buffers::Hex::Encode(AsSpan(std::string("\x12\xAB", 2)), buffer) == Buffers::Write::Status::Success);
+	auto decoded = Buffers::Hex::Decode(buffer);
+	ASSERT_TRUE("test_hex_round_trip", decoded.has_value());
+	ASSERT_EQUAL("test_hex_round_trip", std::string("\x12\xAB", 2), AsString(decoded->Data()));
+	RETURN_TEST("test_hex_round_trip", 0);
+}
+
+int test_hex_rejects_invalid() {
+	const auto text = Buffers::Hex::Encode(AsSpan(Payload(100)));
+	for (std::size_t position : { 0, 1, 30, 31, 64, 199 }) {
+		for (const char bad : { 'g', 'G', ' ', ':', '@', '`', '/', '\xC0' }) {
+			auto corrupted = text;
+			corrupted[position] = bad;
+			auto decoded = Buffers::Hex::Decode(corrupted);
+			ASSERT_FALSE("test_hex_rejects_invalid", decoded.has_value());
+			ASSERT_TRUE("test_hex_rejects_invalid", std::string(decoded.error()->what()).find(std::to_string(position)) != std::string::npos);
+		}
+	}
+	ASSERT_FALSE("test_hex_rejects_invalid", Buffers::Hex::Decode(std::string("ABC")).has_value());
+	RETURN_TEST("test_hex_rejects_invalid", 0);
+}
+
+int test_encoding_pipeline() {
+	const auto data = Payload(100000);
+	Buffers::Status status;
+
+	for (const auto alphabet : { Buffers::Base64::Alphabet::Standard, Buffers::Base64::Alphabet::URL }) {
+		Buffers::Pipeline round_trip;
+		round_trip.AddPipe(Buffers::Base64::Encoder(alphabet));
+		round_trip.AddPipe(Buffers::Base64::Decoder(alphabet));
+		ASSERT_EQUAL("test_encoding_pipeline", data, Run(round_trip, data, status));
+		ASSERT_TRUE("test_encoding_pipeline", status == Buffers::Status::ReadOnly);
+	}
+
+	Buffers::Pipeline encode;
+	encode.AddPipe(Buffers::Base64::Encoder());
+	ASSERT_EQUAL("test_encoding_pipeline", Buffers::Base64::Encode(AsSpan(data)), Run(encode, data, status));
+
+	Buffers::Pipeline decode;
+	decode.AddPipe(Buffers::Base64::Decoder());
+	Run(decode, "Zm9v!mFy", status);
+	ASSERT_TRUE("test_encoding_pipeline", status == Buffers::Status::Error);
+	Run(decode, "Zg==Zm9v", status);
+	ASSERT_TRUE("test_encoding_pipeline", status == Buffers::Status::Error);
+
+	Buffers::Pipeline hex;
+	hex.AddPipe(Buffers::Hex::Encoder());
+	hex.AddPipe(Buffers::Hex::Decoder());
+	ASSERT_EQUAL("test_encoding_pipeline", data, Run(hex, data, status));
+	ASSERT_TRUE("test_encoding_pipeline", status == Buffers::Status::ReadOnly);
+
+	Buffers::Pipeline hex_decode;
+	hex_decode.AddPipe(Buffers::Hex::Decoder());
+	Run(hex_decode, "ABC", status);
+	ASSERT_TRUE("test_encoding_pipeline", status == Buffers::Status::Error);
+
+	// Empty streams are valid empty results
+	ASSERT_EQUAL("test_encoding_pipeline", std::string(), Run(hex, std::string(), status));
+	ASSERT_TRUE("test_encoding_pipeline", status == Buffers::Status::ReadOnly);
+	RETURN_TEST("test_encoding_pipeline", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_base64_known_values();
+	result += test_base64_round_trip();
+	result += test_base64_rejects_invalid();
+	result += test_hex_round_trip();
+	result += test_hex_rejects_invalid();
+	result += test_encoding_pipeline();
+
+	if (result == 0) {
+		std::cout << "All tests passed!" << std::endl;
+	} else {
+		std::cout << result << " tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <StormByte/buffers/consumer.hxx>
+#include <StormByte/buffers/hexdump.hxx>
+#include <StormByte/buffers/producer.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <iostream>
+#include <sstream>
+
+using namespace StormByte;
+
+namespace {
+	// Byte at a time formatter, the layout HexData always had
+	std::string Reference(const Buffers::ConstByteSpan& data, const std::size_t& column_size) {
+		constexpr char digits[] = "0123456789ABCDEF";
+		std::string hex_data, hex_line, char_line;
+		for (const auto& byte : data) {
+			const auto value = static_cast<unsigned char>(byte);
+			hex_line += { digits[value >> 4], digits[value & 0x0F], ' ' };
+			char_line += value >= 0x20 && value < 0x7F ? static_cast<char>(value) : '.';
+			if (char_line.size() == column_size) {
+				hex_data += hex_line + "\t" + char_line + "\n";
+				hex_line.clear();
+				char_line.clear();
+			}
+		}
+		if (!hex_line.empty()) {
+			hex_data += hex_line + std::string(column_size * 3 > hex_line.size() ? column_size * 3 - hex_line.size() : 0, ' ') + "\t" + char_line + "\n";
+		}
+		return hex_data;
+	}
+
+	Buffers::Data AllBytes(const std::size_t& length) {
+		Buffers::Data data(length);
+		for (std::size_t i = 0; i < length; i++) {
+			data[i] = static_cast<Buffers::Byte>((i * 7) % 256);
+		}
+		return data;
+	}
+}
+
+int test_hexdump_matches_reference() {
+	for (const std::size_t length : { 0, 1, 15, 16, 17, 47, 48, 255, 256, 1000 }) {
+		const auto data = AllBytes(length);
+		for (const std::size_t column_size : { 1, 5, 8, 16, 20, 32, 33 }) {
+			const auto expected = Reference(data, column_size);
+			ASSERT_EQUAL("test_hexdump_matches_reference", expected, Buffers::HexDump::Encode(data, column_size));
+			ASSERT_EQUAL("test_hexdump_matches_reference", expected.size(), Buffers::HexDump::Size(length, column_size));
+		}
+		ASSERT_EQUAL("test_hexdump_matches_reference", Reference(data, 0), Buffers::HexDump::Encode(data, 0));
+	}
+	RETURN_TEST("test_hexdump_matches_reference", 0);
+}
+
+int test_hexdata_range() {
+	Buffers::Simple buffer(std::string("Hello, World! This is a hex dump"));
+	const auto whole = buffer.Data();
+	ASSERT_EQUAL("test_hexdata_range", Reference(whole, 16), buffer.HexData());
+	ASSERT_EQUAL("test_hexdata_range", Reference(std::span(whole).subspan(7, 6), 4), buffer.HexData(7, 6, 4));
+	ASSERT_EQUAL("test_hexdata_range", Reference(std::span(whole).subspan(20), 16), buffer.HexData(20, 1000));
+	ASSERT_EQUAL("test_hexdata_range", std::string(), buffer.HexData(1000, 10));
+
+	// Offsets count from the live data, not from discarded bytes
+	buffer.Discard(7, Buffers::Read::Position::Absolute);
+	ASSERT_EQUAL("test_hexdata_range", Reference(std::span(whole).subspan(7, 5), 16), buffer.HexData(0, 5));
+
+	Buffers::Shared shared(std::string("Shared buffer contents"));
+	const auto contents = shared.Data();
+	ASSERT_EQUAL("test_hexdata_range", Reference(contents, 8), shared.HexData(8));
+	ASSERT_EQUAL("test_hexdata_range", Reference(std::span(contents).subspan(7, 6), 16), shared.HexData(7, 6));
+	RETURN_TEST("test_hexdata_range", 0);
+}
+
+int test_hexdata_stream() {
+	// Large enough to span several chunks
+	const auto data = AllBytes(3 * Buffers::HexDump::ChunkSize / 4 + 123);
+	Buffers::Simple buffer(data);
+
+	std::ostringstream stream;
+	buffer.HexData(stream);
+	ASSERT_EQUAL("test_hexdata_stream", Reference(data, 16), stream.str());
+
+	std::ostringstream ranged;
+	buffer.HexData(ranged, 100, 50, 8);
+	ASSERT_EQUAL("test_hexdata_stream", Reference(std::span(data).subspan(100, 50), 8), ranged.str());
+
+	Buffers::Producer producer;
+	auto consumer = producer.Consumer();
+	ASSERT_TRUE("test_hexdata_stream", buffer.HexData(producer) == Buffers::Write::Status::Success);
+	producer << Buffers::Status::ReadOnly;
+	const auto expected = Reference(data, 16);
+	auto dump = consumer.Read(expected.size());
+	ASSERT_TRUE("test_hexdata_stream", dump.has_value());
+	ASSERT_EQUAL("test_hexdata_stream", expected, std::string(reinterpret_cast<const char*>(dump->data()), dump->size()));
+	ASSERT_TRUE("test_hexdata_stream", consumer.IsEoF());
+	RETURN_TEST("test_hexdata_stream", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_hexdump_matches_reference();
+	result += test_hexdata_range();
+	result += test_hexdata_stream();
+
+	if (result == 0) {
+		std::cout << "All tests passed!" << std::endl;
+	} else {
+		std::cout << result << " tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include <StormByte/buffers/chained.hxx>
+#include <StormByte/buffers/consumer.hxx>
+#include <StormByte/buffers/producer.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <iostream>
+#include <thread>
+
+#ifdef WINDOWS
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace StormByte;
+
+namespace {
+	bool OpenPipe(int fds[2]) {
+		#ifdef WINDOWS
+		return _pipe(fds, 1 << 20, _O_BINARY) == 0;
+		#else
+		return pipe(fds) == 0;
+		#endif
+	}
+
+	void Close(const int& fd) {
+		#ifdef WINDOWS
+		_close(fd);
+		#else
+		close(fd);
+		#endif
+	}
+
+	std::string ToString(const Buffers::Data& data) {
+		return std::string(reinterpret_cast<const char*>(data.data()), data.size());
+	}
+}
+
+int test_simple_write_to_read_from() {
+	int fds[2];
+	ASSERT_TRUE("test_simple_write_to_read_from", OpenPipe(fds));
+
+	Buffers::Simple source(std::string("HeaderPayload"));
+	source.Seek(6, Buffers::Read::Position::Absolute);
+	auto written = source.WriteTo(fds[1]);
+	ASSERT_TRUE("test_simple_write_to_read_from", written.has_value());
+	ASSERT_EQUAL("test_simple_write_to_read_from", 7, *written);
+	// Only the unread data is written and then removed
+	ASSERT_EQUAL("test_simple_write_to_read_from", "Header", ToString(source.Data()));
+	Close(fds[1]);
+
+	Buffers::Simple destination(std::string("Got "));
+	auto read = destination.ReadFrom(fds[0], 100);
+	ASSERT_TRUE("test_simple_write_to_read_from", read.has_value());
+	ASSERT_EQUAL("test_simple_write_to_read_from", 7, *read);
+	ASSERT_EQUAL("test_simple_write_to_read_from", "Got Payload", ToString(destination.Data()));
+
+	read = destination.ReadFrom(fds[0], 100);
+	ASSERT_TRUE("test_simple_write_to_read_from", read.has_value());
+	ASSERT_EQUAL("test_simple_write_to_read_from", 0, *read);
+	ASSERT_EQUAL("test_simple_write_to_read_from", 11, destination.Size());
+	Close(fds[0]);
+
+	ASSERT_FALSE("test_simple_write_to_read_from", destination.WriteTo(fds[1]).has_value());
+	RETURN_TEST("test_simple_write_to_read_from", 0);
+}
+
+int test_chained_scatter_gather() {
+	int fds[2];
+	ASSERT_TRUE("test_chained_scatter_gather", OpenPipe(fds));
+
+	Buffers::Chained source;
+	const std::string first(2000, 'a'), second(3000, 'b');
+	source << Buffers::Data(reinterpret_cast<const std::byte*>(first.data()), reinterpret_cast<const std::byte*>(first.data()) + first.size());
+	source << Buffers::Data(reinterpret_cast<const std::byte*>(second.data()), reinterpret_cast<const std::byte*>(second.data()) + second.size());
+	ASSERT_EQUAL("test_chained_scatter_gather", 2, source.Segments());
+	source.Seek(1000, Buffers::Read::Position::Absolute);
+
+	auto written = source.WriteTo(fds[1]);
+	ASSERT_TRUE("test_chained_scatter_gather", written.has_value());
+	ASSERT_EQUAL("test_chained_scatter_gather", 4000, *written);
+	ASSERT_EQUAL("test_chained_scatter_gather", 1000, source.Size());
+	Close(fds[1]);
+
+	Buffers::Chained destination;
+	std::size_t total = 0;
+	while (true) {
+		auto read = destination.ReadFrom(fds[0], 1500);
+		ASSERT_TRUE("test_chained_scatter_gather", read.has_value());
+		if (*read == 0) {
+			break;
+		}
+		total += *read;
+	}
+	Close(fds[0]);
+	ASSERT_EQUAL("test_chained_scatter_gather", 4000, total);
+	ASSERT_EQUAL("test_chained_scatter_gather", first.substr(1000) + second, ToString(destination.Data()));
+	RETURN_TEST("test_chained_scatter_gather", 0);
+}
+
+int test_consumer_drain_to_descriptor() {
+	int fds[2];
+	ASSERT_TRUE("test_consumer_drain_to_descriptor", OpenPipe(fds));
+
+	Buffers::Producer producer;
+	auto consumer = producer.Consumer();
+	std::thread writer([producer]() mutable {
+		for (int i = 0; i < 100; i++) {
+			producer << std::string("0123456789");
+		}
+		producer << Buffers::Status::ReadOnly;
+	});
+
+	// Drain the consumer into the pipe while another producer refills from it
+	Buffers::Producer sink;
+	auto result = sink.Consumer();
+	std::thread reader([&sink, fd = fds[0]]() {
+		while (true) {
+			auto read = sink.ReadFrom(fd, 256);
+			if (!read || *read == 0) {
+				break;
+			}
+		}
+		sink << Buffers::Status::ReadOnly;
+	});
+
+	std::size_t total = 0;
+	while (!consumer.IsEoF()) {
+		auto written = consumer.WriteTo(fds[1]);
+		ASSERT_TRUE("test_consumer_drain_to_descriptor", written.has_value());
+		total += *written;
+		if (*written == 0) {
+			std::this_thread::yield();
+		}
+	}
+	writer.join();
+	Close(fds[1]);
+	reader.join();
+	Close(fds[0]);
+
+	ASSERT_EQUAL("test_consumer_drain_to_descriptor", 1000, total);
+	auto data = result.Read(1000);
+	ASSERT_TRUE("test_consumer_drain_to_descriptor", data.has_value());
+	ASSERT_EQUAL("test_consumer_drain_to_descriptor", '9', static_cast<char>((*data)[999]));
+	RETURN_TEST("test_consumer_drain_to_descriptor", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_simple_write_to_read_from();
+	result += test_chained_scatter_gather();
+	result += test_consumer_drain_to_descriptor();
+
+	if (result == 0) {
+		std::cout << "All tests passed!" << std::endl;
+	} else {
+		std::cout << result << " tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
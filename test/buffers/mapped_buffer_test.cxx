@@ -0,0 +1,144 @@
+#include <StormByte/buffers/mapped.hxx>
+#include <StormByte/buffers/simple.hxx>
+#include <StormByte/system.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <fstream>
+#include <iostream>
+
+using namespace StormByte;
+
+namespace {
+	std::filesystem::path WriteFile(const std::string& contents) {
+		auto path = System::TempFileName("mapped");
+		std::ofstream file(path, std::ios::binary);
+		file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+		return path;
+	}
+
+	std::string ToString(const std::span<const std::byte>& data) {
+		return std::string(reinterpret_cast<const char*>(data.data()), data.size());
+	}
+}
+
+int test_mapped_read_and_seek() {
+	const std::string contents = "Hello mapped World!";
+	auto path = WriteFile(contents);
+	{
+		Buffers::Mapped buffer(path);
+		ASSERT_EQUAL("test_mapped_read_and_seek", contents.size(), buffer.Size());
+		ASSERT_EQUAL("test_mapped_read_and_seek", contents, ToString(buffer.Span()));
+
+		auto peek = buffer.Peek();
+		ASSERT_TRUE("test_mapped_read_and_seek", peek.has_value());
+		ASSERT_EQUAL("test_mapped_read_and_seek", static_cast<char>(*peek), 'H');
+
+		auto read = buffer.Read(5);
+		ASSERT_TRUE("test_mapped_read_and_seek", read.has_value());
+		ASSERT_EQUAL("test_mapped_read_and_seek", "Hello", ToString(*read));
+		ASSERT_EQUAL("test_mapped_read_and_seek", 5, buffer.Position());
+
+		buffer.Seek(-6, Buffers::Read::Position::End);
+		auto view = buffer.ReadView(5);
+		ASSERT_TRUE("test_mapped_read_and_seek", view.has_value());
+		ASSERT_EQUAL("test_mapped_read_and_seek", "World", ToString(*view));
+
+		// Copies share the mapping but not the read position
+		Buffers::Mapped copy(buffer);
+		copy.Seek(0, Buffers::Read::Position::Absolute);
+		ASSERT_EQUAL("test_mapped_read_and_seek", 0, copy.Position());
+		ASSERT_EQUAL("test_mapped_read_and_seek", contents.size() - 1, buffer.Position());
+		ASSERT_TRUE("test_mapped_read_and_seek", copy.Span().data() == buffer.Span().data());
+
+		ASSERT_FALSE("test_mapped_read_and_seek", buffer.Read(2).has_value());
+		ASSERT_FALSE("test_mapped_read_and_seek", buffer.End());
+		ASSERT_TRUE("test_mapped_read_and_seek", buffer.Read(1).has_value());
+		ASSERT_TRUE("test_mapped_read_and_seek", buffer.End());
+	}
+	std::filesystem::remove(path);
+	RETURN_TEST("test_mapped_read_and_seek", 0);
+}
+
+int test_mapped_empty_file() {
+	auto path = WriteFile("");
+	{
+		Buffers::Mapped buffer(path);
+		ASSERT_TRUE("test_mapped_empty_file", buffer.Empty());
+		ASSERT_TRUE("test_mapped_empty_file", buffer.IsEoF());
+		ASSERT_FALSE("test_mapped_empty_file", buffer.Peek().has_value());
+		ASSERT_TRUE("test_mapped_empty_file", buffer.ReadView(0).has_value());
+	}
+	std::filesystem::remove(path);
+	RETURN_TEST("test_mapped_empty_file", 0);
+}
+
+int test_mapped_missing_file() {
+	bool thrown = false;
+	try {
+		Buffers::Mapped buffer(System::TempFileName("mapped") / "missing");
+	} catch (const Buffers::Exception&) {
+		thrown = true;
+	}
+	ASSERT_TRUE("test_mapped_missing_file", thrown);
+	RETURN_TEST("test_mapped_missing_file", 0);
+}
+
+int test_mapped_hexdata_matches_simple() {
+	const std::string contents = "Some \x01\x02 binary\tcontents to dump in hexadecimal";
+	auto path = WriteFile(contents);
+	{
+		Buffers::Mapped mapped(path);
+		Buffers::Simple simple(contents);
+		ASSERT_EQUAL("test_mapped_hexdata_matches_simple", simple.HexData(), mapped.HexData());
+		ASSERT_EQUAL("test_mapped_hexdata_matches_simple", simple.HexData(8), mapped.HexData(8));
+	}
+	std::filesystem::remove(path);
+	RETURN_TEST("test_mapped_hexdata_matches_simple", 0);
+}
+
+int test_mapped_consumer() {
+	std::string contents;
+	for (int i = 0; i < 10000; i++) {
+		contents += std::to_string(i);
+	}
+	auto path = WriteFile(contents);
+	const Buffers::Byte* mapped = nullptr;
+	Buffers::Consumer consumer = [&path, &mapped]() {
+		Buffers::Mapped buffer(path, Buffers::Mapped::Advice::WillNeed);
+		buffer.Seek(10, Buffers::Read::Position::Absolute);
+		mapped = buffer.PeekView(1)->data();
+		// The mapping must survive this instance going out of scope
+		return buffer.Consumer();
+	}();
+
+	// Handed over complete and without copying
+	ASSERT_TRUE("test_mapped_consumer", consumer.Status() == Buffers::Status::ReadOnly);
+	{
+		auto view = consumer.PeekView(1);
+		ASSERT_TRUE("test_mapped_consumer", view.has_value());
+		ASSERT_TRUE("test_mapped_consumer", view->Span().data() == mapped);
+	}
+
+	auto read = consumer.Read(contents.size() - 10);
+	ASSERT_TRUE("test_mapped_consumer", read.has_value());
+	ASSERT_EQUAL("test_mapped_consumer", contents.substr(10), std::string(reinterpret_cast<const char*>(read->data()), read->size()));
+	ASSERT_FALSE("test_mapped_consumer", consumer.Read(1).has_value());
+	std::filesystem::remove(path);
+	RETURN_TEST("test_mapped_consumer", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_mapped_read_and_seek();
+	result += test_mapped_empty_file();
+	result += test_mapped_missing_file();
+	result += test_mapped_hexdata_matches_simple();
+	result += test_mapped_consumer();
+
+	if (result == 0) {
+		std::cout << "All tests passed!" << std::endl;
+	} else {
+		std::cout << result << " tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include <StormByte/buffers/consumer.hxx>
+#include <StormByte/buffers/pool.hxx>
+#include <StormByte/buffers/producer.hxx>
+#include <StormByte/test_handlers.h>
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace StormByte;
+
+int test_pool_simple_buffer() {
+	Buffers::Pool pool;
+	{
+		Buffers::Simple buffer(pool);
+		// Large enough to spill out of the inline storage
+		buffer << std::string("Hello pooled World!") << std::string(Buffers::Storage::InlineCapacity, '.');
+		ASSERT_TRUE("test_pool_simple_buffer", pool.Stats().allocations > 0);
+		ASSERT_TRUE("test_pool_simple_buffer", pool.Stats().slabs > 0);
+
+		// Data read from the buffer is a plain vector
+		auto read = buffer.Read(5);
+		ASSERT_TRUE("test_pool_simple_buffer", read.has_value());
+		ASSERT_EQUAL("test_pool_simple_buffer", "Hello", std::string(reinterpret_cast<const char*>(read->data()), read->size()));
+	}
+	auto stats = pool.Stats();
+	ASSERT_EQUAL("test_pool_simple_buffer", 0, stats.in_use_bytes);
+	ASSERT_EQUAL("test_pool_simple_buffer", stats.allocations, stats.deallocations);
+
+	// Freed blocks are reused from the thread cache
+	{
+		Buffers::Simple buffer(pool);
+		buffer << std::string(Buffers::Storage::InlineCapacity + 1, 'a');
+	}
+	ASSERT_TRUE("test_pool_simple_buffer", pool.Stats().cache_hits > stats.cache_hits);
+	ASSERT_EQUAL("test_pool_simple_buffer", stats.slabs, pool.Stats().slabs);
+	RETURN_TEST("test_pool_simple_buffer", 0);
+}
+
+int test_pool_large_requests_go_upstream() {
+	Buffers::Pool pool;
+	{
+		Buffers::Simple buffer(pool);
+		buffer << std::string(Buffers::Pool::MaximumBlockSize + 1, 'x');
+		ASSERT_TRUE("test_pool_large_requests_go_upstream", pool.Stats().upstream_allocations > 0);
+	}
+	ASSERT_EQUAL("test_pool_large_requests_go_upstream", 0, pool.Stats().in_use_bytes);
+	RETURN_TEST("test_pool_large_requests_go_upstream", 0);
+}
+
+int test_pool_producer_consumer() {
+	Buffers::Pool pool;
+	{
+		Buffers::Producer producer(pool);
+		auto consumer = producer.Consumer();
+		std::thread writer([producer]() mutable {
+			for (int i = 0; i < 1000; i++) {
+				producer << std::string("Chunk of pooled data");
+			}
+			producer << Buffers::Status::ReadOnly;
+		});
+
+		std::size_t total = 0;
+		while (true) {
+			auto chunk = consumer.Extract(20);
+			if (!chunk) {
+				break;
+			}
+			total += chunk->size();
+		}
+		writer.join();
+		ASSERT_EQUAL("test_pool_producer_consumer", 20 * 1000, total);
+	}
+	ASSERT_EQUAL("test_pool_producer_consumer", 0, pool.Stats().in_use_bytes);
+	RETURN_TEST("test_pool_producer_consumer", 0);
+}
+
+int test_pool_plain_data() {
+	Buffers::Pool pool;
+	{
+		// Plain vectors go in and come out of a pooled buffer, the bytes stay in the pool meanwhile
+		Buffers::Simple buffer(pool);
+		std::vector<std::byte> data(Buffers::Storage::InlineCapacity * 2, std::byte { 'p' });
+		buffer << std::move(data);
+		ASSERT_TRUE("test_pool_plain_data", pool.Stats().in_use_bytes > 0);
+		std::vector<std::byte> extracted = buffer.Extract(Buffers::Storage::InlineCapacity * 2).value();
+		ASSERT_EQUAL("test_pool_plain_data", Buffers::Storage::InlineCapacity * 2, extracted.size());
+
+		// The pmr alias allocates from the pool directly
+		const auto before = pool.Stats().allocations;
+		Buffers::pmr::Data pooled(100, std::byte { 'q' }, &pool);
+		ASSERT_TRUE("test_pool_plain_data", pool.Stats().allocations > before);
+	}
+	ASSERT_EQUAL("test_pool_plain_data", 0, pool.Stats().in_use_bytes);
+	RETURN_TEST("test_pool_plain_data", 0);
+}
+
+int test_pool_mixed_buffers() {
+	Buffers::Pool pool;
+	const std::string text(Buffers::Storage::InlineCapacity * 2, 'm');
+	Buffers::Simple written, extracted, assigned;
+	{
+		Buffers::Simple pooled(pool);
+		pooled << text;
+
+		// A default buffer copies pooled bytes instead of sharing or taking them over
+		written << pooled;
+		assigned = pooled;
+		pooled.ExtractInto(text.size(), extracted);
+
+		// A pooled buffer copies default bytes into the pool
+		Buffers::Simple target(pool);
+		const auto before = pool.Stats().allocations;
+		target << written;
+		ASSERT_TRUE("test_pool_mixed_buffers", pool.Stats().allocations > before);
+		Buffers::Simple moved(pool);
+		moved = Buffers::Simple(text);
+		Buffers::Simple output(pool);
+		Buffers::Simple source(text);
+		source.ExtractInto(text.size(), output);
+		ASSERT_EQUAL("test_pool_mixed_buffers", text.size(), output.Size());
+		Buffers::Producer producer(pool);
+		producer << Buffers::Data(Buffers::Shared::AdoptThreshold, std::byte { 'm' });
+		ASSERT_EQUAL("test_pool_mixed_buffers", Buffers::Shared::AdoptThreshold, producer.Consumer().AvailableBytes());
+	}
+	// Nothing outside the pooled buffers kept memory of the pool
+	ASSERT_EQUAL("test_pool_mixed_buffers", 0, pool.Stats().in_use_bytes);
+	for (auto* buffer: { &written, &extracted, &assigned }) {
+		auto data = buffer->Read(text.size());
+		ASSERT_TRUE("test_pool_mixed_buffers", data.has_value());
+		ASSERT_EQUAL("test_pool_mixed_buffers", text, std::string(reinterpret_cast<const char*>(data->data()), data->size()));
+	}
+	RETURN_TEST("test_pool_mixed_buffers", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_pool_simple_buffer();
+	result += test_pool_large_requests_go_upstream();
+	result += test_pool_producer_consumer();
+	result += test_pool_plain_data();
+	result += test_pool_mixed_buffers();
+
+	if (result == 0) {
+		std::cout << "All tests passed!" << std::endl;
+	} else {
+		std::cout << result << " tests failed." << std::endl;
+	}
+	return result;
+}
\ No newline at end of file
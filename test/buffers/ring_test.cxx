@@ -0,0 +1,190 @@
+#include <StormByte/buffers/consumer.hxx>
+#include <StormByte/buffers/producer.hxx>
+#include <StormByte/buffers/ring.hxx>
+#include <StormByte/test_buffers.h>
+#include <StormByte/test_handlers.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace StormByte;
+using namespace StormByte::Test;
+
+namespace {
+	// Streams `total` bytes in `chunk` sized writes from another thread
+	void Stream(Buffers::Producer producer, const std::size_t& total, const std::size_t& chunk, bool& intact) {
+		auto consumer = producer.Consumer();
+		std::thread writer([producer, total, chunk]() mutable {
+			const auto block = Payload(256 * chunk);
+			for (std::size_t written = 0; written < total; written += chunk) {
+				producer.Write(AsSpan(block).subspan(written % block.size(), chunk));
+			}
+			producer << Buffers::Status::ReadOnly;
+		});
+		std::size_t read = 0;
+		intact = true;
+		while (!consumer.IsEoF()) {
+			auto data = consumer.Extract(std::max<std::size_t>(consumer.AvailableBytes(), 1));
+			if (!data) {
+				break;
+			}
+			intact = intact && AsString(*data) == Payload(data->size(), read);
+			read += data->size();
+		}
+		writer.join();
+		intact = intact && read == total;
+	}
+}
+
+int test_ring_push_pop() {
+	Buffers::Ring ring(100);
+	ASSERT_EQUAL("test_ring_push_pop", 128, ring.Capacity());
+	ASSERT_TRUE("test_ring_push_pop", ring.Empty());
+
+	// Fill, drain partially and wrap around the end of the storage
+	ASSERT_TRUE("test_ring_push_pop", ring.Push(AsSpan(Payload(100))));
+	ASSERT_FALSE("test_ring_push_pop", ring.Push(AsSpan(Payload(29, 100))));
+	ASSERT_EQUAL("test_ring_push_pop", 100, ring.Size());
+
+	std::string output(60, '\0');
+	ASSERT_EQUAL("test_ring_push_pop", 60, ring.Pop(Buffers::ByteSpan(reinterpret_cast<std::byte*>(output.data()), output.size())));
+	ASSERT_EQUAL("test_ring_push_pop", Payload(60), output);
+	ASSERT_TRUE("test_ring_push_pop", ring.Push(AsSpan(Payload(88, 100))));
+	ASSERT_EQUAL("test_ring_push_pop", 128, ring.Size());
+
+	const auto [first, second] = ring.Readable();
+	ASSERT_EQUAL("test_ring_push_pop", 68, first.size());
+	ASSERT_EQUAL("test_ring_push_pop", 60, second.size());
+	ring.Consume(first.size());
+
+	output.assign(200, '\0');
+	ASSERT_EQUAL("test_ring_push_pop", 60, ring.Pop(Buffers::ByteSpan(reinterpret_cast<std::byte*>(output.data()), output.size())));
+	ASSERT_EQUAL("test_ring_push_pop", Payload(60, 128), output.substr(0, 60));
+	ASSERT_TRUE("test_ring_push_pop", ring.Empty());
+
+	// Moving keeps the pending bytes
+	ASSERT_TRUE("test_ring_push_pop", ring.Push(AsSpan("abc")));
+	Buffers::Ring moved(std::move(ring));
+	ASSERT_EQUAL("test_ring_push_pop", 3, moved.Size());
+	RETURN_TEST("test_ring_push_pop", 0);
+}
+
+int test_ring_producer_order() {
+	// Writes larger than the ring spill to the locked storage without reordering the stream
+	Buffers::Producer producer(Buffers::Ring(16));
+	auto consumer = producer.Consumer();
+	std::size_t offset = 0;
+	for (std::size_t length : { 5, 10, 40, 3, 16, 1, 17, 8 }) {
+		ASSERT_TRUE("test_ring_producer_order", producer.Write(AsSpan(Payload(length, offset))) == Buffers::Write::Status::Success);
+		offset += length;
+	}
+	producer << std::string("xy");
+	producer << Buffers::Data(3, std::byte { 'z' });
+	ASSERT_EQUAL("test_ring_producer_order", offset + 5, consumer.AvailableBytes());
+
+	auto data = consumer.Extract(offset);
+	ASSERT_TRUE("test_ring_producer_order", data.has_value());
+	ASSERT_EQUAL("test_ring_producer_order", Payload(offset), AsString(*data));
+	auto tail = consumer.Extract(5);
+	ASSERT_TRUE("test_ring_producer_order", tail.has_value());
+	ASSERT_EQUAL("test_ring_producer_order", std::string("xyzzz"), AsString(*tail));
+	RETURN_TEST("test_ring_producer_order", 0);
+}
+
+int test_ring_producer_status() {
+	Buffers::Producer producer(Buffers::Ring(64));
+	auto consumer = producer.Consumer();
+	producer << std::string("data");
+
+	// Bytes still in the ring are read after the write end is closed
+	producer << Buffers::Status::ReadOnly;
+	ASSERT_TRUE("test_ring_producer_status", producer.Write(std::string("late")) == Buffers::Write::Status::Error);
+	ASSERT_FALSE("test_ring_producer_status", consumer.IsEoF());
+	auto data = consumer.Extract(4);
+	ASSERT_TRUE("test_ring_producer_status", data.has_value());
+	ASSERT_EQUAL("test_ring_producer_status", std::string("data"), AsString(*data));
+	ASSERT_TRUE("test_ring_producer_status", consumer.IsEoF());
+	ASSERT_FALSE("test_ring_producer_status", consumer.Extract(1).has_value());
+
+	// Clearing drops pending ring bytes too
+	Buffers::Shared cleared(Buffers::Ring(64));
+	cleared << std::string("pending");
+	cleared.Clear();
+	cleared << std::string("new");
+	ASSERT_EQUAL("test_ring_producer_status", std::string("new"), AsString(cleared.Data()));
+	RETURN_TEST("test_ring_producer_status", 0);
+}
+
+int test_ring_lock_free_reads() {
+	Buffers::Producer producer(Buffers::Ring(64));
+	auto consumer = producer.Consumer();
+	producer << std::string("head");
+	auto view = consumer.ReadView(4);
+	ASSERT_TRUE("test_ring_lock_free_reads", view.has_value());
+
+	// The view holds the lock, so reaching the ring bytes below must not need it
+	producer << std::string("tail");
+	ASSERT_EQUAL("test_ring_lock_free_reads", 4, consumer.AvailableBytes());
+	ASSERT_TRUE("test_ring_lock_free_reads", consumer.HasEnoughData(4));
+	ASSERT_EQUAL("test_ring_lock_free_reads", 8, consumer.Size());
+	auto data = consumer.Extract(4);
+	ASSERT_TRUE("test_ring_lock_free_reads", data.has_value());
+	ASSERT_EQUAL("test_ring_lock_free_reads", std::string("tail"), AsString(*data));
+	ASSERT_EQUAL("test_ring_lock_free_reads", std::string("head"), std::string(reinterpret_cast<const char*>(view->Span().data()), 4));
+	ASSERT_TRUE("test_ring_lock_free_reads", consumer.End());
+	RETURN_TEST("test_ring_lock_free_reads", 0);
+}
+
+int test_ring_drain_order() {
+	Buffers::Producer producer(Buffers::Ring(64));
+	auto first = producer.Consumer();
+	auto second = first;
+	producer << std::string("head");
+	std::string extracted;
+	std::thread reader;
+	{
+		// The transaction moves the ring bytes into the buffer and keeps it locked until it ends
+		auto transaction = producer.Transaction();
+		std::thread([producer]() mutable { producer << std::string("tail"); }).join();
+		// Extracting straight from the ring now would return the bytes written after the moved ones
+		reader = std::thread([&second, &extracted]() {
+			auto data = second.Extract(4);
+			extracted = data ? AsString(*data) : std::string();
+		});
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+	reader.join();
+	ASSERT_EQUAL("test_ring_drain_order", std::string("head"), extracted);
+	auto data = first.Extract(4);
+	ASSERT_TRUE("test_ring_drain_order", data.has_value());
+	ASSERT_EQUAL("test_ring_drain_order", std::string("tail"), AsString(*data));
+	RETURN_TEST("test_ring_drain_order", 0);
+}
+
+int test_ring_concurrent_stream() {
+	bool intact = false;
+	Stream(Buffers::Producer(Buffers::Ring(4096)), 4 * 1024 * 1024, 64, intact);
+	ASSERT_TRUE("test_ring_concurrent_stream", intact);
+	Stream(Buffers::Producer(Buffers::Ring(64)), 1000000, 100, intact);
+	ASSERT_TRUE("test_ring_concurrent_stream", intact);
+	RETURN_TEST("test_ring_concurrent_stream", 0);
+}
+
+int main() {
+	int result = 0;
+	result += test_ring_push_pop();
+	result += test_ring_producer_order();
+	result += test_ring_producer_status();
+	result += test_ring_lock_free_reads();
+	result += test_ring_drain_order();
+	result += test_ring_concurrent_stream();
+
+	if (result == 0) {
+		std::cout << "All tests passed!" << std::endl;
+	} else {
+		std::cout << result << " tests failed." << std::endl;
+	}
+	return result;
+}
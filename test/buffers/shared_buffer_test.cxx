@@ -1,6 +1,11 @@
+#include <StormByte/buffers/consumer.hxx>
+#include <StormByte/buffers/producer.hxx>
 #include <StormByte/buffers/shared.hxx>
 #include <StormByte/test_handlers.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <set>
 #include <thread>
 
@@ -279,6 +284,601 @@ int test_if_copy_copies_status() {
 	return 0;
 }
 
+int test_shared_views() {
+	Buffers::Shared buffer;
+
+	std::thread writer([&buffer]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		buffer << std::string("Header");
+		buffer << std::string("Payload");
+		buffer << Buffers::Status::ReadOnly;
+	});
+
+	{
+		// Waits for the data, then pins it while the view is alive
+		auto header = buffer.ReadView(6);
+		ASSERT_TRUE("test_shared_views", header.has_value());
+		ASSERT_EQUAL("test_shared_views", "Header", std::string(reinterpret_cast<const char*>(header->Span().data()), header->Size()));
+	}
+	writer.join();
+
+	{
+		auto payload = buffer.PeekView(7);
+		ASSERT_TRUE("test_shared_views", payload.has_value());
+		ASSERT_EQUAL("test_shared_views", 'P', static_cast<char>((*payload)[0]));
+	}
+	ASSERT_EQUAL("test_shared_views", 6, buffer.Position());
+	ASSERT_FALSE("test_shared_views", buffer.ReadView(8).has_value());
+
+	RETURN_TEST("test_shared_views", 0);
+}
+
+int test_shared_typed_access() {
+	Buffers::Shared buffer;
+
+	std::thread writer([&buffer]() {
+		buffer.WriteAs<std::uint16_t>(0xCAFE, std::endian::big);
+		// A varint split across writes is only decoded once its last byte arrives
+		for (const unsigned char byte : { 0x80, 0x80, 0x01 }) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			buffer << static_cast<std::uint8_t>(byte);
+		}
+		buffer << Buffers::Status::ReadOnly;
+	});
+
+	ASSERT_EQUAL("test_shared_typed_access", 0xCAFE, buffer.ReadAs<std::uint16_t>(std::endian::big).value());
+	ASSERT_EQUAL("test_shared_typed_access", 1u << 14, buffer.ReadVarint<std::uint32_t>().value());
+	writer.join();
+	ASSERT_FALSE("test_shared_typed_access", buffer.ReadVarint<std::uint32_t>().has_value());
+	ASSERT_FALSE("test_shared_typed_access", buffer.WriteAs(1) == Buffers::Write::Status::Success);
+
+	RETURN_TEST("test_shared_typed_access", 0);
+}
+
+int test_shared_read_until_waits() {
+	Buffers::Shared buffer;
+
+	std::thread writer([&buffer]() {
+		// The second line ends with a terminator split across writes
+		for (const std::string chunk : { "first li", "ne\nsecond\r", "\nlast" }) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			buffer << chunk;
+		}
+		buffer << Buffers::Status::ReadOnly;
+	});
+
+	ASSERT_EQUAL("test_shared_read_until_waits", "first line", buffer.ReadLine().value());
+	auto second = buffer.ReadUntil(std::string("\r\n"));
+	ASSERT_TRUE("test_shared_read_until_waits", second.has_value());
+	ASSERT_EQUAL("test_shared_read_until_waits", "second", std::string(reinterpret_cast<const char*>(second->data()), second->size()));
+	writer.join();
+	ASSERT_FALSE("test_shared_read_until_waits", buffer.ReadLine().has_value());
+	ASSERT_EQUAL("test_shared_read_until_waits", 3, buffer.Find(std::byte { 't' }).value());
+
+	RETURN_TEST("test_shared_read_until_waits", 0);
+}
+
+int test_shared_wakeup_latency() {
+	Buffers::Shared ping, pong;
+	constexpr int rounds = 200;
+
+	// Each round trip blocks both sides once: a polling wait would take seconds
+	std::thread echo([&ping, &pong]() {
+		for (int i = 0; i < rounds; i++) {
+			auto byte = ping.Extract(1);
+			if (!byte) {
+				break;
+			}
+			pong << std::move(*byte);
+		}
+	});
+
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < rounds; i++) {
+		ping << std::string("x");
+		ASSERT_TRUE("test_shared_wakeup_latency", pong.Extract(1).has_value());
+	}
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	echo.join();
+	ASSERT_TRUE("test_shared_wakeup_latency", elapsed < std::chrono::seconds(2));
+
+	// Closing the write end wakes a blocked reader as well
+	std::thread closer([&ping]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		ping << Buffers::Status::ReadOnly;
+	});
+	const auto wait_start = std::chrono::steady_clock::now();
+	ASSERT_FALSE("test_shared_wakeup_latency", ping.Extract(1).has_value());
+	closer.join();
+	ASSERT_TRUE("test_shared_wakeup_latency", std::chrono::steady_clock::now() - wait_start < std::chrono::seconds(1));
+
+	RETURN_TEST("test_shared_wakeup_latency", 0);
+}
+
+int test_shared_backpressure() {
+	Buffers::Shared buffer;
+	buffer.Limit(64, 16);
+	const std::string block(64, 'b');
+	const Buffers::ConstByteSpan span(reinterpret_cast<const std::byte*>(block.data()), 8);
+
+	// At the high-water mark timed writes give up without writing anything
+	ASSERT_TRUE("test_shared_backpressure", buffer.Write(block) == Buffers::Write::Status::Success);
+	ASSERT_TRUE("test_shared_backpressure", buffer.Write(span, std::chrono::milliseconds(0)) == Buffers::Write::Status::Timeout);
+	ASSERT_TRUE("test_shared_backpressure", buffer.Write(span, std::chrono::milliseconds(10)) == Buffers::Write::Status::Timeout);
+	ASSERT_EQUAL("test_shared_backpressure", 64, buffer.AvailableBytes());
+
+	// A blocked write resumes once readers drain the buffer to the low-water mark
+	std::thread reader([&buffer]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		(void)buffer.Extract(40);
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		(void)buffer.Extract(10);
+	});
+	ASSERT_TRUE("test_shared_backpressure", buffer.Write(block) == Buffers::Write::Status::Success);
+	reader.join();
+	ASSERT_EQUAL("test_shared_backpressure", 78, buffer.AvailableBytes());
+
+	auto stats = buffer.Stats();
+	ASSERT_EQUAL("test_shared_backpressure", 3, stats.blocked_writes);
+	ASSERT_EQUAL("test_shared_backpressure", 2, stats.write_timeouts);
+	ASSERT_TRUE("test_shared_backpressure", stats.blocked_time >= std::chrono::milliseconds(30));
+
+	// Closing the buffer releases blocked writers with an error
+	std::thread closer([&buffer]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		buffer << Buffers::Status::ReadOnly;
+	});
+	ASSERT_TRUE("test_shared_backpressure", buffer.Write(block) == Buffers::Write::Status::Error);
+	closer.join();
+
+	// A streaming writer never gets far ahead of its reader
+	Buffers::Shared stream;
+	stream.Limit(4096, 1024);
+	std::thread writer([&stream, &span]() {
+		for (int i = 0; i < 100000; i++) {
+			stream.Write(span);
+		}
+		stream << Buffers::Status::ReadOnly;
+	});
+	std::size_t read = 0, peak = 0;
+	while (!stream.IsEoF()) {
+		peak = std::max(peak, stream.AvailableBytes());
+		auto data = stream.Extract(std::max<std::size_t>(stream.AvailableBytes(), 1));
+		if (!data) {
+			break;
+		}
+		read += data->size();
+	}
+	writer.join();
+	ASSERT_EQUAL("test_shared_backpressure", 800000, read);
+	ASSERT_TRUE("test_shared_backpressure", peak < 4096 + span.size());
+
+	RETURN_TEST("test_shared_backpressure", 0);
+}
+
+int test_shared_deadlines() {
+	Buffers::Producer producer;
+	auto consumer = producer.Consumer();
+	producer << std::string("abc");
+
+	// Available data is returned at once, missing data times out with a distinct error
+	auto data = consumer.TryRead(2);
+	ASSERT_TRUE("test_shared_deadlines", data.has_value());
+	auto missing = consumer.TryExtract(10);
+	ASSERT_FALSE("test_shared_deadlines", missing.has_value());
+	ASSERT_TRUE("test_shared_deadlines", std::dynamic_pointer_cast<Buffers::BufferTimeout>(missing.error()) != nullptr);
+
+	const auto start = std::chrono::steady_clock::now();
+	missing = consumer.Read(10, std::chrono::milliseconds(30));
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	ASSERT_FALSE("test_shared_deadlines", missing.has_value());
+	ASSERT_TRUE("test_shared_deadlines", std::dynamic_pointer_cast<Buffers::BufferTimeout>(missing.error()) != nullptr);
+	ASSERT_TRUE("test_shared_deadlines", elapsed >= std::chrono::milliseconds(30) && elapsed < std::chrono::seconds(1));
+
+	// Data arriving before the deadline is returned
+	std::thread writer([&producer]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		producer << std::string("defg");
+	});
+	auto extracted = consumer.Extract(5, std::chrono::steady_clock::now() + std::chrono::seconds(5));
+	writer.join();
+	ASSERT_TRUE("test_shared_deadlines", extracted.has_value());
+	ASSERT_EQUAL("test_shared_deadlines", std::string("cdefg"), std::string(reinterpret_cast<const char*>(extracted->data()), extracted->size()));
+
+	// A closed buffer reports a plain overflow, not a timeout
+	producer << Buffers::Status::ReadOnly;
+	missing = consumer.Extract(10, std::chrono::seconds(5));
+	ASSERT_FALSE("test_shared_deadlines", missing.has_value());
+	ASSERT_TRUE("test_shared_deadlines", std::dynamic_pointer_cast<Buffers::BufferTimeout>(missing.error()) == nullptr);
+	RETURN_TEST("test_shared_deadlines", 0);
+}
+
+int test_shared_transaction() {
+	Buffers::Producer producer(Buffers::Ring(64));
+	auto consumer = producer.Consumer();
+
+	// Frames are a 16-bit length and the payload, written together so readers never see half a frame
+	std::thread writer([producer]() mutable {
+		for (std::uint16_t i = 0; i < 500; i++) {
+			const std::string payload(i % 40, static_cast<char>('a' + i % 26));
+			auto transaction = producer.Transaction();
+			transaction->WriteAs<std::uint16_t>(static_cast<std::uint16_t>(payload.size()), std::endian::big);
+			transaction->Write(payload);
+		}
+		producer << Buffers::Status::ReadOnly;
+	});
+
+	std::size_t frames = 0;
+	while (!consumer.IsEoF()) {
+		{
+			auto transaction = consumer.Transaction();
+			while (transaction->HasEnoughData(2)) {
+				const auto length = transaction->PeekAs<std::uint16_t>(std::endian::big);
+				ASSERT_TRUE("test_shared_transaction", length.has_value());
+				ASSERT_TRUE("test_shared_transaction", transaction->HasEnoughData(2 + *length));
+				transaction->Discard(2);
+				auto payload = transaction->Extract(*length);
+				ASSERT_TRUE("test_shared_transaction", payload.has_value());
+				ASSERT_EQUAL("test_shared_transaction", frames % 40, payload->size());
+				ASSERT_TRUE("test_shared_transaction", std::all_of(payload->begin(), payload->end(), [frames](std::byte b) { return b == static_cast<std::byte>('a' + frames % 26); }));
+				frames++;
+			}
+		}
+		// Transactions never wait: wait for the next frame header outside of them
+		(void)consumer.PeekAs<std::uint16_t>();
+	}
+	writer.join();
+	ASSERT_EQUAL("test_shared_transaction", 500, frames);
+
+	// Changes made through a transaction wake readers waiting for them
+	Buffers::Producer late;
+	auto waiting = late.Consumer();
+	std::thread reader([&waiting]() mutable {
+		auto data = waiting.Extract(3);
+		ASSERT_TRUE("test_shared_transaction", data.has_value());
+		return 0;
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	{
+		auto transaction = late.Transaction();
+		transaction->Write(std::string("xyz"));
+	}
+	reader.join();
+	ASSERT_TRUE("test_shared_transaction", waiting.Empty());
+	RETURN_TEST("test_shared_transaction", 0);
+}
+
+int test_shared_metrics() {
+	Buffers::Producer producer;
+	auto consumer = producer.Consumer();
+	producer << std::string("0123456789");
+	producer.Write(Buffers::Data(6, std::byte { 'x' }));
+	(void)consumer.Read(4);
+	(void)consumer.Extract(8);
+	std::thread writer([&producer]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		producer << std::string("late");
+	});
+	(void)consumer.Extract(8);
+	writer.join();
+
+	const auto stats = consumer.Stats();
+	if constexpr (Buffers::Metrics::Enabled) {
+		ASSERT_EQUAL("test_shared_metrics", 20, stats.bytes_written);
+		ASSERT_EQUAL("test_shared_metrics", 3, stats.writes);
+		ASSERT_EQUAL("test_shared_metrics", 4, stats.bytes_read);
+		ASSERT_EQUAL("test_shared_metrics", 16, stats.bytes_extracted);
+		ASSERT_EQUAL("test_shared_metrics", 3, stats.reads);
+		ASSERT_EQUAL("test_shared_metrics", 16, stats.peak_size);
+		ASSERT_TRUE("test_shared_metrics", stats.wait_time > std::chrono::nanoseconds(0));
+		ASSERT_TRUE("test_shared_metrics", stats.lock_wait.Count() > 0);
+		ASSERT_TRUE("test_shared_metrics", stats.lock_hold.Count() > 0);
+		ASSERT_TRUE("test_shared_metrics", stats.lock_hold.Percentile(0.5) <= stats.lock_hold.Percentile(1.0));
+	} else {
+		// Compiled out: nothing is counted
+		ASSERT_EQUAL("test_shared_metrics", 0, stats.bytes_written);
+		ASSERT_EQUAL("test_shared_metrics", 0, stats.reads);
+		ASSERT_EQUAL("test_shared_metrics", 0, stats.lock_wait.Count());
+	}
+
+	// Histograms bucket durations by powers of two
+	Buffers::Metrics::Recorder recorder;
+	recorder.Record(std::chrono::nanoseconds(0));
+	recorder.Record(std::chrono::nanoseconds(100));
+	recorder.Record(std::chrono::microseconds(100));
+	recorder.Record(std::chrono::seconds(100));
+	const auto histogram = recorder.Snapshot();
+	ASSERT_EQUAL("test_shared_metrics", 4, histogram.Count());
+	ASSERT_EQUAL("test_shared_metrics", 1, histogram.counts[6]);
+	ASSERT_EQUAL("test_shared_metrics", 1, histogram.counts[Buffers::Metrics::Histogram::Buckets - 1]);
+	ASSERT_EQUAL("test_shared_metrics", std::chrono::nanoseconds(128).count(), histogram.Percentile(0.5).count());
+	RETURN_TEST("test_shared_metrics", 0);
+}
+
+int test_shared_concurrent_readers() {
+	Buffers::Shared buffer;
+	constexpr std::uint64_t records = 20000;
+	constexpr int reader_count = 4;
+	std::vector<std::vector<std::uint64_t>> seen(reader_count);
+	std::atomic<bool> done { false };
+	std::atomic<bool> moved_back { false };
+	std::atomic<std::uint64_t> queries { 0 };
+
+	// Readers share the read position: every record must be taken by exactly one of them
+	const auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> readers;
+	for (int i = 0; i < reader_count; i++) {
+		readers.emplace_back([&buffer, &seen, i]() {
+			while (true) {
+				std::uint64_t value;
+				if (i % 2 == 0) {
+					auto read = buffer.ReadAs<std::uint64_t>();
+					if (!read) {
+						break;
+					}
+					value = *read;
+				} else {
+					auto read = buffer.Read(sizeof(value));
+					if (!read) {
+						break;
+					}
+					std::memcpy(&value, read->data(), sizeof(value));
+				}
+				seen[i].push_back(value);
+			}
+		});
+	}
+	std::thread monitor([&buffer, &done, &moved_back, &queries]() {
+		std::size_t last = 0;
+		while (!done.load()) {
+			const std::size_t position = buffer.Position();
+			(void)buffer.AvailableBytes();
+			moved_back = moved_back || position < last;
+			last = position;
+			queries++;
+		}
+	});
+	for (std::uint64_t i = 0; i < records; i++) {
+		buffer << i;
+	}
+	buffer << Buffers::Status::ReadOnly;
+	for (auto& reader: readers) {
+		reader.join();
+	}
+	const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	done = true;
+	monitor.join();
+
+	std::vector<std::uint64_t> all;
+	for (const auto& values: seen) {
+		all.insert(all.end(), values.begin(), values.end());
+	}
+	std::sort(all.begin(), all.end());
+	ASSERT_EQUAL("test_shared_concurrent_readers", records, all.size());
+	for (std::uint64_t i = 0; i < all.size(); i++) {
+		ASSERT_EQUAL("test_shared_concurrent_readers", i, all[i]);
+	}
+	ASSERT_FALSE("test_shared_concurrent_readers", moved_back.load());
+	ASSERT_EQUAL("test_shared_concurrent_readers", records * sizeof(std::uint64_t), buffer.Position());
+	ASSERT_EQUAL("test_shared_concurrent_readers", 0, buffer.AvailableBytes());
+
+	std::cout << reader_count << " readers: " << static_cast<std::uint64_t>(records / elapsed) << " records/s, "
+			  << static_cast<std::uint64_t>(queries.load() / elapsed) << " lock-free queries/s" << std::endl;
+	RETURN_TEST("test_shared_concurrent_readers", 0);
+}
+
+int test_shared_chunk_handoff() {
+	const std::size_t size = 64 * 1024;
+	Buffers::Data chunk(size, std::byte { 'x' });
+	const auto* bytes = chunk.data();
+
+	// A forwarding stage moves whole chunks along without copying a byte, even past the ring
+	Buffers::Producer producer(Buffers::Ring(4096));
+	auto consumer = producer.Consumer();
+	Buffers::Producer next;
+	auto next_consumer = next.Consumer();
+	ASSERT_TRUE("test_shared_chunk_handoff", Buffers::Write::Status::Success == producer.Write(std::move(chunk)));
+	auto forwarded = consumer.Extract(size);
+	ASSERT_TRUE("test_shared_chunk_handoff", forwarded.has_value());
+	ASSERT_TRUE("test_shared_chunk_handoff", forwarded->data() == bytes);
+	ASSERT_TRUE("test_shared_chunk_handoff", Buffers::Write::Status::Success == next.Write(std::move(*forwarded)));
+
+	Buffers::Shared output;
+	ASSERT_TRUE("test_shared_chunk_handoff", Buffers::Read::Status::Success == next_consumer.ExtractInto(size, output));
+	auto received = output.Extract(size);
+	ASSERT_TRUE("test_shared_chunk_handoff", received.has_value());
+	ASSERT_TRUE("test_shared_chunk_handoff", received->data() == bytes);
+
+	// Small vectors still go through the ring
+	producer.Write(Buffers::Data(5, std::byte { 's' }));
+	auto small = consumer.Extract(5);
+	ASSERT_TRUE("test_shared_chunk_handoff", small.has_value());
+	ASSERT_EQUAL("test_shared_chunk_handoff", 's', static_cast<char>(small->back()));
+	RETURN_TEST("test_shared_chunk_handoff", 0);
+}
+
+int test_producer_write_combining() {
+	Buffers::Producer producer;
+	auto consumer = producer.Consumer();
+	producer.Coalesce(64);
+
+	// Small writes stay staged until the threshold is reached
+	for (std::uint32_t i = 0; i < 15; i++) {
+		producer.WriteAs<std::uint32_t>(i, std::endian::big);
+	}
+	ASSERT_EQUAL("test_producer_write_combining", 0, consumer.AvailableBytes());
+	producer.WriteAs<std::uint32_t>(15, std::endian::big);
+	ASSERT_EQUAL("test_producer_write_combining", 64, consumer.AvailableBytes());
+
+	// Large writes and explicit flushes keep the order
+	producer << std::string("ab");
+	producer.Write(Buffers::Data(100, std::byte { 'L' }));
+	ASSERT_EQUAL("test_producer_write_combining", 166, consumer.AvailableBytes());
+	producer << std::string("cd");
+	ASSERT_TRUE("test_producer_write_combining", Buffers::Write::Status::Success == producer.Flush());
+	ASSERT_EQUAL("test_producer_write_combining", 168, consumer.AvailableBytes());
+
+	// Copies do not duplicate staged bytes, and staged bytes are published when their producer goes away
+	producer << std::string("e");
+	{
+		Buffers::Producer copy(producer);
+		copy << std::string("f");
+	}
+	ASSERT_EQUAL("test_producer_write_combining", 169, consumer.AvailableBytes());
+
+	// A producer going away never waits for room: its staged bytes are dropped instead
+	producer.Limit(1);
+	{
+		Buffers::Producer copy(producer);
+		copy << std::string("x");
+	}
+	ASSERT_EQUAL("test_producer_write_combining", 169, consumer.AvailableBytes());
+	producer.Limit(0);
+	producer << Buffers::Status::ReadOnly;
+	ASSERT_TRUE("test_producer_write_combining", consumer.Status() == Buffers::Status::ReadOnly);
+	ASSERT_TRUE("test_producer_write_combining", Buffers::Write::Status::Error == producer.Write(std::string("g")));
+
+	for (std::uint32_t i = 0; i < 16; i++) {
+		ASSERT_EQUAL("test_producer_write_combining", i, consumer.ReadAs<std::uint32_t>(std::endian::big).value());
+	}
+	auto rest = consumer.Extract(consumer.AvailableBytes());
+	ASSERT_TRUE("test_producer_write_combining", rest.has_value());
+	const std::string tail(reinterpret_cast<const char*>(rest->data()), rest->size());
+	ASSERT_EQUAL("test_producer_write_combining", "ab" + std::string(100, 'L') + "cdfe", tail);
+
+	// Chatty producers take the lock once per batch instead of once per record
+	constexpr std::uint32_t records = 200000;
+	const auto produce = [](const std::size_t& threshold) {
+		Buffers::Producer output;
+		auto input = output.Consumer();
+		output.Coalesce(threshold);
+		std::thread reader([&input]() {
+			while (input.Extract(4 * 1024).has_value()) {}
+		});
+		const auto start = std::chrono::steady_clock::now();
+		for (std::uint32_t i = 0; i < records; i++) {
+			output.WriteAs<std::uint32_t>(i);
+		}
+		output << Buffers::Status::ReadOnly;
+		reader.join();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	};
+	const double direct = produce(0), combined = produce(4 * 1024);
+	std::cout << "Small writes: " << static_cast<std::uint64_t>(records / direct) << " records/s direct, "
+			  << static_cast<std::uint64_t>(records / combined) << " records/s combined" << std::endl;
+	RETURN_TEST("test_producer_write_combining", 0);
+}
+
+int test_shared_broadcast() {
+	Buffers::Producer producer;
+	auto metrics = producer.Subscribe();
+	auto archive = producer.Subscribe();
+
+	// Every subscriber sees the whole stream with its own read position
+	producer << std::string("hello");
+	ASSERT_EQUAL("test_shared_broadcast", std::string("hello"), std::string(reinterpret_cast<const char*>(metrics.Extract(5)->data()), 5));
+	ASSERT_EQUAL("test_shared_broadcast", std::string("hello"), std::string(reinterpret_cast<const char*>(archive.Read(5)->data()), 5));
+	ASSERT_EQUAL("test_shared_broadcast", 5, archive.Position());
+	ASSERT_EQUAL("test_shared_broadcast", 0, metrics.Position());
+
+	// Consumers of the producer read the stream too, from where it was when they were taken
+	auto late = producer.Consumer();
+	archive.Discard(5, Buffers::Read::Position::Begin);
+	Buffers::Data chunk(4096, std::byte { 'c' });
+	const auto* bytes = chunk.data();
+	producer.Write(std::move(chunk));
+	ASSERT_EQUAL("test_shared_broadcast", 4096, metrics.AvailableBytes());
+	ASSERT_EQUAL("test_shared_broadcast", 4096, archive.AvailableBytes());
+	ASSERT_EQUAL("test_shared_broadcast", 4096, late.AvailableBytes());
+
+	// Readers holding no unconsumed bytes share the chunk instead of copying it
+	ASSERT_TRUE("test_shared_broadcast", metrics.PeekView(4096)->Span().data() == bytes);
+	ASSERT_TRUE("test_shared_broadcast", archive.PeekView(4096)->Span().data() == bytes);
+	ASSERT_TRUE("test_shared_broadcast", late.PeekView(4096)->Span().data() == bytes);
+	(void)metrics.Extract(4096);
+	(void)archive.Extract(4096);
+
+	// The bound waits for the slowest subscriber, a dropped subscriber no longer counts
+	producer.Limit(8);
+	ASSERT_TRUE("test_shared_broadcast", Buffers::Write::Status::Timeout == producer.Write(Buffers::ConstByteSpan(bytes, 1), std::chrono::milliseconds(0)));
+	ASSERT_EQUAL("test_shared_broadcast", 0, metrics.AvailableBytes());
+	late = Buffers::Producer().Consumer();
+	ASSERT_TRUE("test_shared_broadcast", Buffers::Write::Status::Success == producer.Write(Buffers::ConstByteSpan(bytes, 1), std::chrono::milliseconds(0)));
+	(void)metrics.Extract(1);
+	(void)archive.Extract(1);
+	producer.Limit(0);
+
+	// Concurrent subscribers each get every record in order, then the status
+	constexpr std::uint32_t records = 10000;
+	std::vector<int> failures(2, 0);
+	std::vector<std::thread> readers;
+	for (auto* consumer: { &metrics, &archive }) {
+		readers.emplace_back([consumer, &failures, index = readers.size()]() {
+			for (std::uint32_t i = 0; i < records; i++) {
+				auto value = consumer->ReadAs<std::uint32_t>();
+				if (!value || *value != i) {
+					failures[index]++;
+					return;
+				}
+				consumer->Discard(sizeof(std::uint32_t), Buffers::Read::Position::Begin);
+			}
+			if (consumer->Extract(1).has_value()) {
+				failures[index]++;
+			}
+		});
+	}
+	for (std::uint32_t i = 0; i < records; i++) {
+		producer.WriteAs<std::uint32_t>(i);
+	}
+	producer << Buffers::Status::ReadOnly;
+	for (auto& reader: readers) {
+		reader.join();
+	}
+	ASSERT_EQUAL("test_shared_broadcast", 0, failures[0]);
+	ASSERT_EQUAL("test_shared_broadcast", 0, failures[1]);
+	ASSERT_TRUE("test_shared_broadcast", metrics.Status() == Buffers::Status::ReadOnly);
+	RETURN_TEST("test_shared_broadcast", 0);
+}
+
+int test_shared_broadcast_writes() {
+	const auto text = [](const Buffers::ExpectedData<Buffers::BufferOverflow>& data) {
+		return data ? std::string(reinterpret_cast<const char*>(data->data()), data->size()) : std::string();
+	};
+
+	// Consumers taken before the first subscriber keep receiving the stream
+	Buffers::Producer producer;
+	auto early = producer.Consumer();
+	producer << std::string("ab");
+	auto subscriber = producer.Subscribe();
+	producer << std::string("cd");
+	ASSERT_EQUAL("test_shared_broadcast_writes", std::string("abcd"), text(early.Extract(4)));
+	ASSERT_EQUAL("test_shared_broadcast_writes", 2, subscriber.AvailableBytes());
+
+	// Transactions are broadcast as every other write
+	{
+		auto transaction = producer.Transaction();
+		transaction->Write(std::string("ef"));
+	}
+	ASSERT_EQUAL("test_shared_broadcast_writes", std::string("ef"), text(early.Extract(2)));
+	ASSERT_EQUAL("test_shared_broadcast_writes", std::string("cdef"), text(subscriber.Extract(4)));
+
+	// So are the bytes moved in by ExtractInto and operator>>
+	Buffers::Shared broadcast;
+	auto copy = broadcast.Subscribe();
+	Buffers::Shared input(std::string("ghij"));
+	ASSERT_TRUE("test_shared_broadcast_writes", input.ExtractInto(2, broadcast) == Buffers::Read::Status::Success);
+	input >> broadcast;
+	ASSERT_EQUAL("test_shared_broadcast_writes", std::string("ghij"), text(copy->Extract(4)));
+
+	// A moved broadcast keeps feeding the subscribers of the buffer it was moved from
+	Buffers::Shared moved(std::move(broadcast));
+	ASSERT_TRUE("test_shared_broadcast_writes", moved.IsBroadcasting());
+	ASSERT_FALSE("test_shared_broadcast_writes", broadcast.IsBroadcasting());
+	moved << std::string("kl");
+	ASSERT_EQUAL("test_shared_broadcast_writes", std::string("kl"), text(copy->Extract(2)));
+	RETURN_TEST("test_shared_broadcast_writes", 0);
+}
+
 int main() {
 	int result = 0;
 	result += test_concurrent_writes();
@@ -289,6 +889,19 @@ int main() {
 	result += test_extract_into_multithreaded();
 	result += test_shared_available_bytes();
 	result += test_if_copy_copies_status();
+	result += test_shared_views();
+	result += test_shared_typed_access();
+	result += test_shared_read_until_waits();
+	result += test_shared_wakeup_latency();
+	result += test_shared_backpressure();
+	result += test_shared_deadlines();
+	result += test_shared_transaction();
+	result += test_shared_metrics();
+	result += test_shared_concurrent_readers();
+	result += test_shared_chunk_handoff();
+	result += test_producer_write_combining();
+	result += test_shared_broadcast();
+	result += test_shared_broadcast_writes();
 
 	if (result == 0) {
 		std::cout << "All tests passed!" << std::endl;
@@ -1,8 +1,10 @@
+#include <StormByte/buffers/pool.hxx>
 #include <StormByte/buffers/simple.hxx>
 #include <StormByte/test_handlers.h>
 
 #include <iostream>
 #include <thread>
+#include <utility>
 
 using namespace StormByte;
 
@@ -252,6 +254,286 @@ int test_simple_copy_out_of_scope() {
 	RETURN_TEST("test_simple_copy_out_of_scope", 0);
 }
 
+int test_simple_framed_extract() {
+	Buffers::Simple buffer;
+	std::string expected;
+	for (int i = 0; i < 1000; ++i) {
+		std::string frame = std::to_string(i);
+		frame.insert(0, 16 - frame.size(), '0');
+		buffer << frame;
+		expected += frame;
+	}
+
+	// Pull frames off the front, interleaving writes so compaction and appends mix
+	std::string actual;
+	for (std::size_t i = 0; i < 1000; ++i) {
+		auto frame = buffer.Extract(16);
+		ASSERT_TRUE("test_simple_framed_extract", frame.has_value());
+		actual.append(reinterpret_cast<const char*>(frame->data()), frame->size());
+		ASSERT_EQUAL("test_simple_framed_extract", 0, buffer.Position());
+		ASSERT_EQUAL("test_simple_framed_extract", (999 - i) * 16, buffer.Size());
+	}
+	ASSERT_EQUAL("test_simple_framed_extract", expected, actual);
+	ASSERT_TRUE("test_simple_framed_extract", buffer.Empty());
+
+	// Relative discard in the middle keeps Position and Span consistent
+	buffer << std::string("Hello, World!");
+	buffer.Discard(2, Buffers::Read::Position::Begin);
+	buffer.Seek(3, Buffers::Read::Position::Begin);
+	buffer.Discard(2, Buffers::Read::Position::Relative);
+	ASSERT_EQUAL("test_simple_framed_extract", 3, buffer.Position());
+	std::string remaining(reinterpret_cast<const char*>(buffer.Span().data()), buffer.Span().size());
+	ASSERT_EQUAL("test_simple_framed_extract", "lloWorld!", remaining);
+	auto peeked = buffer.Peek();
+	ASSERT_TRUE("test_simple_framed_extract", peeked.has_value());
+	ASSERT_EQUAL("test_simple_framed_extract", 'W', static_cast<char>(peeked.value()));
+	buffer.Seek(-6, Buffers::Read::Position::End);
+	auto tail = buffer.Read(6);
+	ASSERT_TRUE("test_simple_framed_extract", tail.has_value());
+	ASSERT_EQUAL("test_simple_framed_extract", "World!", std::string(reinterpret_cast<const char*>(tail->data()), tail->size()));
+
+	RETURN_TEST("test_simple_framed_extract", 0);
+}
+
+int test_simple_views() {
+	Buffers::Simple buffer { "HeaderPayload", 13 };
+
+	auto peeked = buffer.PeekView(6);
+	ASSERT_TRUE("test_simple_views", peeked.has_value());
+	ASSERT_EQUAL("test_simple_views", 0, buffer.Position());
+	ASSERT_TRUE("test_simple_views", peeked->data() == buffer.Span().data());
+
+	auto header = buffer.ReadView(6);
+	ASSERT_TRUE("test_simple_views", header.has_value());
+	ASSERT_EQUAL("test_simple_views", "Header", std::string(reinterpret_cast<const char*>(header->data()), header->size()));
+	ASSERT_EQUAL("test_simple_views", 6, buffer.Position());
+
+	auto payload = buffer.ReadView(7);
+	ASSERT_TRUE("test_simple_views", payload.has_value());
+	ASSERT_EQUAL("test_simple_views", "Payload", std::string(reinterpret_cast<const char*>(payload->data()), payload->size()));
+	ASSERT_FALSE("test_simple_views", buffer.PeekView(1).has_value());
+
+	RETURN_TEST("test_simple_views", 0);
+}
+
+int test_simple_inline_storage() {
+	Buffers::Pool pool;
+	Buffers::Simple buffer(pool);
+
+	// Scalars stay inline and never reach the memory resource
+	buffer << 42 << 3.5 << std::string("tiny");
+	ASSERT_EQUAL("test_simple_inline_storage", 0, pool.Stats().allocations);
+	ASSERT_EQUAL("test_simple_inline_storage", sizeof(int) + sizeof(double) + 4, buffer.Size());
+	buffer.Discard(sizeof(int), Buffers::Read::Position::Begin);
+	ASSERT_EQUAL("test_simple_inline_storage", 0, pool.Stats().allocations);
+
+	// Growing past the inline area spills to the heap (bytes plus their reference count) and keeps the contents
+	const std::string large(Buffers::Storage::InlineCapacity, 'x');
+	buffer << large;
+	ASSERT_EQUAL("test_simple_inline_storage", 2, pool.Stats().allocations);
+	ASSERT_EQUAL("test_simple_inline_storage", sizeof(double) + 4 + large.size(), buffer.Size());
+	buffer.Discard(sizeof(double), Buffers::Read::Position::Begin);
+	auto extracted = buffer.Extract(4 + large.size());
+	ASSERT_TRUE("test_simple_inline_storage", extracted.has_value());
+	ASSERT_EQUAL("test_simple_inline_storage", "tiny" + large, std::string(reinterpret_cast<const char*>(extracted->data()), extracted->size()));
+	ASSERT_TRUE("test_simple_inline_storage", buffer.Empty());
+
+	// Moving and copying inline buffers preserves the contents
+	Buffers::Simple small("inline", 6);
+	Buffers::Simple moved(std::move(small));
+	Buffers::Simple copied(moved);
+	ASSERT_EQUAL("test_simple_inline_storage", "inline", std::string(reinterpret_cast<const char*>(copied.Data().data()), copied.Size()));
+	ASSERT_EQUAL("test_simple_inline_storage", moved.Size(), copied.Size());
+
+	RETURN_TEST("test_simple_inline_storage", 0);
+}
+
+int test_simple_typed_access() {
+	Buffers::Simple buffer;
+	buffer.WriteAs<std::uint32_t>(0x01020304, std::endian::big);
+	buffer.WriteAs<std::uint16_t>(0x0506, std::endian::little);
+	buffer.WriteAs(-2.5);
+	const auto bytes = buffer.Data();
+	ASSERT_EQUAL("test_simple_typed_access", 0x01, static_cast<int>(bytes[0]));
+	ASSERT_EQUAL("test_simple_typed_access", 0x04, static_cast<int>(bytes[3]));
+	ASSERT_EQUAL("test_simple_typed_access", 0x06, static_cast<int>(bytes[4]));
+
+	ASSERT_EQUAL("test_simple_typed_access", 0x04030201u, buffer.PeekAs<std::uint32_t>(std::endian::little).value());
+	ASSERT_EQUAL("test_simple_typed_access", 0x01020304u, buffer.ReadAs<std::uint32_t>(std::endian::big).value());
+	ASSERT_EQUAL("test_simple_typed_access", 0x0506, buffer.ReadAs<std::uint16_t>(std::endian::little).value());
+	ASSERT_EQUAL("test_simple_typed_access", -2.5, buffer.ReadAs<double>().value());
+	ASSERT_FALSE("test_simple_typed_access", buffer.ReadAs<std::uint8_t>().has_value());
+
+	// Interoperates with the host endian operator<<
+	buffer << 1234567;
+	ASSERT_EQUAL("test_simple_typed_access", 1234567, buffer.ReadAs<int>().value());
+
+	// Reference LEB128 encodings
+	Buffers::Simple varints;
+	varints.WriteVarint(624485u);
+	varints.WriteVarint(-123456);
+	varints.WriteVarint(-1);
+	const auto encoded = varints.Data();
+	ASSERT_EQUAL("test_simple_typed_access", 7, encoded.size());
+	ASSERT_EQUAL("test_simple_typed_access", 0xE5, static_cast<int>(encoded[0]));
+	ASSERT_EQUAL("test_simple_typed_access", 0x26, static_cast<int>(encoded[2]));
+	ASSERT_EQUAL("test_simple_typed_access", 0xC0, static_cast<int>(encoded[3]));
+	ASSERT_EQUAL("test_simple_typed_access", 0x78, static_cast<int>(encoded[5]));
+	ASSERT_EQUAL("test_simple_typed_access", 0x7F, static_cast<int>(encoded[6]));
+	ASSERT_EQUAL("test_simple_typed_access", 624485u, varints.ReadVarint<unsigned int>().value());
+	ASSERT_EQUAL("test_simple_typed_access", -123456, varints.ReadVarint<int>().value());
+	ASSERT_EQUAL("test_simple_typed_access", -1, varints.ReadVarint<std::int8_t>().value());
+
+	// Limits round trip, out of range values and truncated input are errors
+	varints.WriteVarint(std::numeric_limits<std::int64_t>::min());
+	varints.WriteVarint(std::numeric_limits<std::uint64_t>::max());
+	varints.WriteVarint(300);
+	ASSERT_EQUAL("test_simple_typed_access", std::numeric_limits<std::int64_t>::min(), varints.ReadVarint<std::int64_t>().value());
+	ASSERT_EQUAL("test_simple_typed_access", std::numeric_limits<std::uint64_t>::max(), varints.ReadVarint<std::uint64_t>().value());
+	ASSERT_FALSE("test_simple_typed_access", varints.ReadVarint<std::uint8_t>().has_value());
+	varints << static_cast<std::uint8_t>(0x80);
+	ASSERT_FALSE("test_simple_typed_access", varints.ReadVarint<int>().has_value());
+	ASSERT_EQUAL("test_simple_typed_access", 1, varints.AvailableBytes());
+
+	// A 10th byte carrying bits past bit 63 overflows
+	Buffers::Simple overlong;
+	for (int i = 0; i < 9; i++) {
+		overlong << static_cast<std::uint8_t>(0xFF);
+	}
+	overlong << static_cast<std::uint8_t>(0x03);
+	ASSERT_FALSE("test_simple_typed_access", overlong.ReadVarint<std::uint64_t>().has_value());
+	ASSERT_FALSE("test_simple_typed_access", overlong.ReadVarint<std::int64_t>().has_value());
+	ASSERT_EQUAL("test_simple_typed_access", 10, overlong.AvailableBytes());
+
+	RETURN_TEST("test_simple_typed_access", 0);
+}
+
+int test_simple_copy_on_write() {
+	Buffers::Pool pool;
+	Buffers::Simple original(pool);
+	original << std::string(1000, 'a') << std::string(1000, 'b');
+	const auto allocations = pool.Stats().allocations;
+	const auto data = [](const Buffers::Simple& buffer) { return buffer.Span().data(); };
+
+	// Copies, slices and writes into empty buffers share the bytes without allocating
+	Buffers::Simple copy(original);
+	auto slice = original.Slice(900, 200);
+	Buffers::Simple appended(pool);
+	appended << original;
+	ASSERT_TRUE("test_simple_copy_on_write", slice.has_value());
+	ASSERT_EQUAL("test_simple_copy_on_write", allocations, pool.Stats().allocations);
+	ASSERT_TRUE("test_simple_copy_on_write", data(copy) == data(original));
+	ASSERT_TRUE("test_simple_copy_on_write", data(*slice) == data(original) + 900);
+	ASSERT_TRUE("test_simple_copy_on_write", data(appended) == data(original));
+	ASSERT_EQUAL("test_simple_copy_on_write", 200, slice->Size());
+	ASSERT_EQUAL("test_simple_copy_on_write", 'a', static_cast<char>(slice->Read(100)->back()));
+	ASSERT_EQUAL("test_simple_copy_on_write", 'b', static_cast<char>(slice->Read(1)->front()));
+
+	// Consuming from the front only narrows the shared window
+	copy.Discard(1500, Buffers::Read::Position::Begin);
+	ASSERT_TRUE("test_simple_copy_on_write", data(copy) == data(original) + 1500);
+
+	// Writing copies first, the other owners keep their bytes
+	copy << std::string("tail");
+	original.Span()[0] = std::byte { 'z' };
+	ASSERT_FALSE("test_simple_copy_on_write", data(copy) == data(original) + 1500);
+	ASSERT_EQUAL("test_simple_copy_on_write", 504, copy.Size());
+	ASSERT_EQUAL("test_simple_copy_on_write", 'a', static_cast<char>(appended.Peek().value()));
+	ASSERT_EQUAL("test_simple_copy_on_write", 'z', static_cast<char>(original.Peek().value()));
+
+	// Extracting shared storage copies it out and leaves the other owners intact
+	auto extracted = appended.Extract(2000);
+	ASSERT_TRUE("test_simple_copy_on_write", extracted.has_value());
+	ASSERT_EQUAL("test_simple_copy_on_write", 2000, extracted->size());
+	ASSERT_EQUAL("test_simple_copy_on_write", 99, slice->AvailableBytes());
+	ASSERT_EQUAL("test_simple_copy_on_write", 'b', static_cast<char>(slice->Span().back()));
+
+	// Reading through the const span keeps sharing, removing bytes from the middle copies first
+	Buffers::Simple shared(original);
+	ASSERT_TRUE("test_simple_copy_on_write", std::as_const(shared).Span().data() == data(original));
+	shared.Seek(10, Buffers::Read::Position::Begin);
+	shared.Discard(10);
+	ASSERT_FALSE("test_simple_copy_on_write", data(shared) == data(original));
+	ASSERT_EQUAL("test_simple_copy_on_write", 1990, shared.Size());
+	ASSERT_EQUAL("test_simple_copy_on_write", 2000, original.Size());
+
+	ASSERT_FALSE("test_simple_copy_on_write", original.Slice(1999, 2).has_value());
+	RETURN_TEST("test_simple_copy_on_write", 0);
+}
+
+int test_simple_chunk_handoff() {
+	Buffers::Data chunk(4096, std::byte { 'c' });
+	const auto* bytes = chunk.data();
+	const auto data = [](const Buffers::Simple& buffer) { return buffer.Span().data(); };
+
+	// A moved vector is adopted, and extracting the whole buffer into an empty one hands it along
+	Buffers::Simple source(std::move(chunk));
+	Buffers::Simple forwarded;
+	ASSERT_TRUE("test_simple_chunk_handoff", data(source) == bytes);
+	ASSERT_TRUE("test_simple_chunk_handoff", Buffers::Read::Status::Success == source.ExtractInto(4096, forwarded));
+	ASSERT_TRUE("test_simple_chunk_handoff", data(forwarded) == bytes);
+	ASSERT_TRUE("test_simple_chunk_handoff", source.Empty());
+	ASSERT_EQUAL("test_simple_chunk_handoff", 4096, forwarded.Size());
+
+	// The consumed prefix travels with the storage
+	forwarded.Discard(96, Buffers::Read::Position::Begin);
+	Buffers::Simple rest;
+	ASSERT_TRUE("test_simple_chunk_handoff", Buffers::Read::Status::Success == forwarded.ExtractInto(4000, rest));
+	ASSERT_TRUE("test_simple_chunk_handoff", data(rest) == bytes + 96);
+	ASSERT_EQUAL("test_simple_chunk_handoff", 4000, rest.Size());
+	ASSERT_EQUAL("test_simple_chunk_handoff", 0, rest.Position());
+
+	// Targets already holding data get a copy appended
+	source << std::string("more");
+	ASSERT_TRUE("test_simple_chunk_handoff", Buffers::Read::Status::Success == source.ExtractInto(4, rest));
+	ASSERT_EQUAL("test_simple_chunk_handoff", 4004, rest.Size());
+	ASSERT_EQUAL("test_simple_chunk_handoff", 'e', static_cast<char>(rest.Span().back()));
+	RETURN_TEST("test_simple_chunk_handoff", 0);
+}
+
+int test_simple_find_and_read_until() {
+	Buffers::Simple buffer(std::string("GET / HTTP/1.1\r\nHost: example\r\n\r\nbody"));
+	ASSERT_EQUAL("test_simple_find_and_read_until", 3, buffer.Find(std::byte { ' ' }).value());
+	ASSERT_FALSE("test_simple_find_and_read_until", buffer.Find(std::byte { '#' }).has_value());
+
+	ASSERT_EQUAL("test_simple_find_and_read_until", "GET / HTTP/1.1", buffer.ReadLine().value());
+	ASSERT_EQUAL("test_simple_find_and_read_until", 4, buffer.Find(std::byte { ':' }).value());
+	auto header = buffer.ReadUntil(std::string("\r\n"));
+	ASSERT_TRUE("test_simple_find_and_read_until", header.has_value());
+	ASSERT_EQUAL("test_simple_find_and_read_until", "Host: example", std::string(reinterpret_cast<const char*>(header->data()), header->size()));
+	ASSERT_EQUAL("test_simple_find_and_read_until", "", buffer.ReadLine().value());
+
+	// Missing delimiters consume nothing
+	ASSERT_FALSE("test_simple_find_and_read_until", buffer.ReadLine().has_value());
+	ASSERT_EQUAL("test_simple_find_and_read_until", 4, buffer.AvailableBytes());
+
+	// A position past the end finds nothing instead of searching outside the data
+	buffer.Seek(100, Buffers::Read::Position::Begin);
+	ASSERT_FALSE("test_simple_find_and_read_until", buffer.Find(std::byte { 'a' }).has_value());
+	ASSERT_FALSE("test_simple_find_and_read_until", buffer.Find(Buffers::ConstByteSpan(reinterpret_cast<const std::byte*>("ab"), 2)).has_value());
+	ASSERT_FALSE("test_simple_find_and_read_until", buffer.ReadLine().has_value());
+
+	// Pattern search agrees with std::search at every length and alignment
+	std::string text;
+	for (std::size_t i = 0; i < 300; i++) {
+		text += static_cast<char>('a' + (i * i + i / 7) % 3);
+	}
+	Buffers::Simple haystack(text);
+	for (std::size_t length = 1; length <= 20; length++) {
+		for (std::size_t start = 0; start + length <= text.size(); start += 13) {
+			const std::string pattern = text.substr(start, length) + (length > 10 ? "c" : "");
+			const auto expected = text.find(pattern);
+			const auto found = haystack.Find(Buffers::ConstByteSpan(reinterpret_cast<const std::byte*>(pattern.data()), pattern.size()));
+			ASSERT_EQUAL("test_simple_find_and_read_until", expected != std::string::npos, found.has_value());
+			if (found) {
+				ASSERT_EQUAL("test_simple_find_and_read_until", expected, *found);
+			}
+		}
+	}
+
+	RETURN_TEST("test_simple_find_and_read_until", 0);
+}
+
 int main() {
 	int result = 0;
 	result += test_simple_buffer();
@@ -266,6 +548,13 @@ int main() {
 	result += test_extract_into();
 	result += test_simple_available_bytes();
 	result += test_simple_copy_out_of_scope();
+	result += test_simple_framed_extract();
+	result += test_simple_views();
+	result += test_simple_inline_storage();
+	result += test_simple_typed_access();
+	result += test_simple_copy_on_write();
+	result += test_simple_chunk_handoff();
+	result += test_simple_find_and_read_until();
 
 	if (result == 0) {
 		std::cout << "All tests passed!" << std::endl;